@@ -0,0 +1,87 @@
+/**
+ * @brief It defines the arena interface
+ *
+ * An arena hands out memory from big blocks, so that the entities of a world
+ * are made without a malloc each, lie next to each other, and are all freed
+ * at once when the arena is destroyed.
+ *
+ * Memory given back to the arena is kept in a list for its size class
+ * (multiples of ARENA_ALIGN bytes) and handed out again for the next request
+ * of the same class, so a world that keeps making and destroying entities,
+ * as level streaming does, does not grow.
+ *
+ * Every function also takes a NULL arena, and then it works on the heap with
+ * malloc, realloc and free, so a module can use them whether it was given an
+ * arena or not.
+ *
+ * @file arena.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include "types.h"
+
+#define ARENA_ALIGN 16 /*!< Alignment of every piece, and step between size classes */
+
+/*Names the struct Arena as a _Arena structure*/
+typedef struct _Arena Arena;
+
+/**
+ * @brief allocates memory for a new arena, without any block yet
+ * @return a Pointer to the new structure Arena or NULL
+*/
+Arena *arena_create();
+
+/**
+ * @brief frees the arena and every piece it handed out
+ * @param arena Pointer to structure Arena
+ * @return OK if it freed all or ERROR
+*/
+STATUS arena_destroy(Arena *arena);
+
+/**
+ * @brief takes back every piece the arena handed out, keeping its last block to hand them out again
+ * @param arena Pointer to structure Arena
+ * @return OK or ERROR
+*/
+STATUS arena_clear(Arena *arena);
+
+/**
+ * @brief gives a piece of memory, not initialized
+ * @param arena Pointer to structure Arena, or NULL to use malloc
+ * @param size number of bytes
+ * @return the piece, aligned to ARENA_ALIGN, or NULL
+*/
+void *arena_alloc(Arena *arena, size_t size);
+
+/**
+ * @brief gives back a piece, to be handed out again
+ * @param arena Pointer to structure Arena it came from, or NULL if it came from malloc
+ * @param p the piece, NULL does nothing
+ * @param size number of bytes it was asked with
+*/
+void arena_free(Arena *arena, void *p, size_t size);
+
+/**
+ * @brief changes the size of a piece, copying what fits
+ * @param arena Pointer to structure Arena it came from, or NULL if it came from malloc
+ * @param p the piece, or NULL to make a new one
+ * @param old_size number of bytes it was asked with
+ * @param size number of bytes wanted
+ * @return the piece, which may have moved, or NULL leaving the old one as it was
+*/
+void *arena_realloc(Arena *arena, void *p, size_t old_size, size_t size);
+
+/**
+ * @brief gives the bytes taken from the system by the arena
+ * @param arena Pointer to structure Arena
+ * @return the bytes in its blocks, -1 if there was some mistake
+*/
+long arena_get_size(Arena *arena);
+
+#endif
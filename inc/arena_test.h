@@ -0,0 +1,26 @@
+/** 
+ * @brief It declares the tests for the arena module
+ * 
+ * @file arena_test.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+*/
+
+#ifndef ARENA_TEST_H
+#define ARENA_TEST_H
+
+void test1_arena_create();
+void test1_arena_destroy();
+void test2_arena_destroy();
+void test1_arena_alloc();
+void test2_arena_alloc();
+void test3_arena_alloc();
+void test1_arena_free();
+void test2_arena_free();
+void test1_arena_realloc();
+void test2_arena_realloc();
+void test1_arena_clear();
+void test2_arena_clear();
+
+#endif
@@ -0,0 +1,110 @@
+/**
+ * @brief It defines the room art store interface
+ *
+ * The graphic description of the spaces is not kept in memory after the
+ * load. For every space the store only records where its lines start in the
+ * data file and how many there are, and reads them the first time they are
+ * asked for. Only the art of the last spaces used stays resident: when
+ * there are more than the given cap, the least recently used is dropped and
+ * read again if it is needed later.
+ *
+ * Every different line read is kept once, however many arts have it, and
+ * an art in memory only points to its lines, so the memory of the art grows
+ * with the different lines of the file and not with the number of rooms.
+ * The lines stay until the store is destroyed.
+ *
+ * Arts can also be fixed: their lines are already in memory, for instance
+ * in the tables of a world built into the program, and are used in place.
+ *
+ * @file art.h
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef ART_H
+#define ART_H
+
+#include "types.h"
+
+#define ART_MAX_RESIDENT 32 /*!< Default number of arts kept in memory */
+
+/*Names the struct ArtStore as a _ArtStore structure*/
+typedef struct _ArtStore ArtStore;
+
+/**
+ * @brief allocates memory for a new, empty art store
+ * @param path Name of the data file the art is read from, NULL if only fixed arts are added
+ * @param max_resident Maximum number of arts kept in memory, at least 1
+ * @return a Pointer to the new structure ArtStore or NULL
+*/
+ArtStore *art_create(const char *path, int max_resident);
+
+/**
+ * @brief frees the store and every art in memory
+ * @param store Pointer to structure ArtStore
+ * @return OK if it freed all or ERROR
+*/
+STATUS art_destroy(ArtStore *store);
+
+/**
+ * @brief records an art of the data file, without reading it
+ * @param store Pointer to structure ArtStore
+ * @param offset position of its first line in the file
+ * @param nlines number of lines
+ * @return the number that identifies the art in the store, or -1
+*/
+int art_add(ArtStore *store, long offset, int nlines);
+
+/**
+ * @brief records an art whose lines are already in memory. They are not copied, so they must last
+ * as long as the store, and they never count as resident
+ * @param store Pointer to structure ArtStore
+ * @param lines the lines of the art
+ * @param nlines number of lines
+ * @return the number that identifies the art in the store, or -1
+*/
+int art_add_fixed(ArtStore *store, const char *const *lines, int nlines);
+
+/**
+ * @brief changes where an art is in the data file, dropping it from memory if it was read
+ * @param store Pointer to structure ArtStore
+ * @param art number of the art
+ * @param offset position of its first line in the file
+ * @param nlines number of lines
+ * @return OK or ERROR
+*/
+STATUS art_set(ArtStore *store, int art, long offset, int nlines);
+
+/**
+ * @brief gives a line of an art, reading the art from the file if it is not in memory
+ * @param store Pointer to structure ArtStore
+ * @param art number of the art
+ * @param i number of the line
+ * @return the line, valid as long as the store, or NULL
+*/
+const char *art_get_line(ArtStore *store, int art, int i);
+
+/**
+ * @brief gives the number of lines of an art
+ * @param store Pointer to structure ArtStore
+ * @param art number of the art
+ * @return number of lines or -1
+*/
+int art_get_nlines(ArtStore *store, int art);
+
+/**
+ * @brief gives the number of arts in memory
+ * @param store Pointer to structure ArtStore
+ * @return number of arts or -1
+*/
+int art_get_resident(ArtStore *store);
+
+/**
+ * @brief gives the number of different lines read from the data file, fixed arts not included
+ * @param store Pointer to structure ArtStore
+ * @return number of lines or -1
+*/
+int art_get_unique(ArtStore *store);
+
+#endif
@@ -0,0 +1,28 @@
+/** 
+ * @brief It declares the tests for the art store module
+ * 
+ * @file art_test.h
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+*/
+
+#ifndef ART_TEST_H
+#define ART_TEST_H
+
+void test1_art_create();
+void test2_art_create();
+void test1_art_destroy();
+void test1_art_add();
+void test2_art_add();
+void test1_art_get_line();
+void test2_art_get_line();
+void test3_art_get_line();
+void test1_art_get_resident();
+void test2_art_get_resident();
+void test1_art_set();
+void test1_art_add_fixed();
+void test2_art_add_fixed();
+void test1_art_get_unique();
+
+#endif
@@ -16,6 +16,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "types.h"
+#include "arena.h"
 
 #define MX_BUFF_DEBUFF 3
 
@@ -26,6 +27,21 @@ typedef struct _BD BD;
  */
 BD *bd_create();
 
+/**
+ * @brief It creates a new buff_debuff structure taking the memory from an arena
+ * @param arena the arena, or NULL to use the heap
+ * @return a new BD, initialized
+ */
+BD *bd_create_in(Arena *arena);
+
+/**
+ * @brief It creates a new buff_debuff structure with the same type and value as another one, taking the memory from an arena
+ * @param arena the arena, or NULL to use the heap
+ * @param bd the buff/debuff structure to copy
+ * @return a new BD, or NULL
+ */
+BD *bd_copy_in(Arena *arena, BD *bd);
+
 /**
  * @brief It destroys a BD, freeing the allocated memory
  * @param bd a pointer to the buff/debuff structure that must be destroyed  
@@ -1,5 +1,12 @@
 /**
  * @brief It defines the enemy's interface
+ *
+ * The data of the enemies is kept by columns in an EnemyTable: one array for
+ * the ids, one for the locations, one for the health and so on, with the
+ * handles of the names in the table of the program (see strtab.h). An Enemy is a handle to a row of a table, so a pass over one
+ * stat of every enemy reads a single array. An enemy made with enemy_create
+ * has a table of its own.
+ *
  * @name enemy.h
  * @author Ignacio Serena
  * @date 16-02-2022
@@ -10,11 +17,14 @@
 #define ENEMY_H
 
 #include "types.h"
+#include "arena.h"
+#include "strtab.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
 typedef struct _Enemy Enemy;
+typedef struct _EnemyTable EnemyTable;
 
 /**
  * @brief It allocates memory for a structure Enemy, it initialize location
@@ -25,6 +35,21 @@ typedef struct _Enemy Enemy;
 */
 Enemy *enemy_create();
 
+/**
+ * @brief It allocates a new enemy in a row of a table, with the same initial data as enemy_create.
+ * @param t Pointer to structure EnemyTable.
+ * @return returns a Pointer to the new Enemy, else, it returns NULL.
+*/
+Enemy *enemy_create_in(EnemyTable *t);
+
+/**
+ * @brief It allocates a new enemy in a row of a table, with the same data as another enemy.
+ * @param t Pointer to structure EnemyTable.
+ * @param e Pointer to structure Enemy to copy, which may be in another table.
+ * @return returns a Pointer to the new Enemy, else, it returns NULL.
+*/
+Enemy *enemy_copy_in(EnemyTable *t, Enemy *e);
+
 /**
  * @brief It gives you the Enemy's Id.
  * @param e Pointer to structure Enemy.
@@ -43,10 +68,17 @@ STATUS enemy_setId(Enemy *e, Id id);
 /**
  * @brief It gives the Enemy's name.
  * @param e Pointer to structure Enemy.
- * @return returns the Enemy's name, else, it returns NULL.
+ * @return returns the Enemy's name, which must not be changed, else, it returns NULL.
 */
 char *enemy_getName(Enemy *e);
 
+/**
+ * @brief It gives the handle of the Enemy's name, equal for equal names.
+ * @param e Pointer to structure Enemy.
+ * @return returns the handle of the name in the table of the program, NO_STR if it has none.
+*/
+StrId enemy_getNameId(Enemy *e);
+
 /**
  * @brief It changes the Enemy's name.
  * @param e Pointer to structure Enemy.
@@ -155,4 +187,78 @@ float enemy_getDefense(Enemy *e);
 */
 STATUS enemy_setDefense(Enemy *e, float d);
 
+/**
+ * @brief It allocates an empty table of enemies.
+ * @return returns a Pointer to the new EnemyTable, else, it returns NULL.
+*/
+EnemyTable *enemy_table_create();
+
+/**
+ * @brief It allocates an empty table of enemies whose handles and names come from an arena. The
+ * columns are kept in the heap, since they grow as one.
+ * @param arena Pointer to structure Arena, or NULL to use the heap.
+ * @return returns a Pointer to the new EnemyTable, else, it returns NULL.
+*/
+EnemyTable *enemy_table_create_in(Arena *arena);
+
+/**
+ * @brief It frees a table. The enemies in it must not be used anymore, but they must still be destroyed
+ * unless they came from an arena that is destroyed with it.
+ * @param t Pointer to structure EnemyTable.
+ * @return returns OK if it runned correctly, else, it returns ERROR.
+*/
+STATUS enemy_table_destroy(EnemyTable *t);
+
+/**
+ * @brief It takes every row out of a table, keeping the memory of its columns. As with
+ * enemy_table_destroy, its enemies must not be used anymore.
+ * @param t Pointer to structure EnemyTable.
+ * @return returns OK if it runned correctly, else, it returns ERROR.
+*/
+STATUS enemy_table_clear(EnemyTable *t);
+
+/**
+ * @brief It gives the number of rows of a table, one for each enemy made in it.
+ * @param t Pointer to structure EnemyTable.
+ * @return returns the number of rows, else, it returns -1.
+*/
+int enemy_table_get_number(EnemyTable *t);
+
+/**
+ * @brief It gives the column of the locations. It stays valid until another enemy is made in the table.
+ * @param t Pointer to structure EnemyTable.
+ * @return returns the location of every row, else, it returns NULL.
+*/
+Id *enemy_table_get_locations(EnemyTable *t);
+
+/**
+ * @brief It gives the column of the health. It stays valid until another enemy is made in the table.
+ * @param t Pointer to structure EnemyTable.
+ * @return returns the health of every row, else, it returns NULL.
+*/
+int *enemy_table_get_health(EnemyTable *t);
+
+/**
+ * @brief It gives the column of the attack. It stays valid until another enemy is made in the table.
+ * @param t Pointer to structure EnemyTable.
+ * @return returns the attack of every row, else, it returns NULL.
+*/
+float *enemy_table_get_attack(EnemyTable *t);
+
+/**
+ * @brief It gives the column of the defense. It stays valid until another enemy is made in the table.
+ * @param t Pointer to structure EnemyTable.
+ * @return returns the defense of every row, else, it returns NULL.
+*/
+float *enemy_table_get_defense(EnemyTable *t);
+
+/**
+ * @brief It heals every enemy of a table that is not dead, without going over a maximum.
+ * @param t Pointer to structure EnemyTable.
+ * @param amount health given to each enemy.
+ * @param max health no enemy goes over.
+ * @return returns the number of enemies healed, else, it returns -1.
+*/
+int enemy_table_heal(EnemyTable *t, int amount, int max);
+
 #endif
\ No newline at end of file
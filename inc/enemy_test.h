@@ -32,6 +32,11 @@ void test1_enemy_setLocation();
 void test2_enemy_setLocation();
 void test1_enemy_getLocation();
 void test2_enemy_getLocation();
+void test1_enemy_create_in();
+void test2_enemy_create_in();
+void test1_enemy_table_heal();
+void test1_enemy_copy_in();
+void test1_enemy_table_clear();
 
 
 #endif
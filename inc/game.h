@@ -11,9 +11,6 @@
 #ifndef GAME_H
 #define GAME_H
 
-#define MAX_OBJECTS 100
-#define MAX_ENEMY 100
-#define MAX_LINKS 400
 #define MAX_S 235
 
 #include "command.h"
@@ -24,13 +21,37 @@
 #include "set.h"
 #include "enemy.h"
 #include "link.h"
+#include "art.h"
+#include "idmap.h"
+#include "names.h"
+#include "arena.h"
 
 typedef struct _Game {
+  Arena *arena;                 /*Memory every entity added to the game must be made in, freed with it*/
   Player *play;                 /*Pointer to Player*/
-  Enemy *enemy[MAX_ENEMY];      /*Pointer to Enemys*/ 
-  Object *objects[MAX_OBJECTS]; /*Pointer to Objects*/
-  Space *spaces[MAX_SPACES];    /*Pointer to spaces*/
-  Link *links[MAX_LINKS];       /*Pointer to links*/
+  Enemy **enemy;                /*Pointer to Enemys, ended by a NULL*/
+  EnemyTable *enemy_table;      /*Data of the enemies, by columns*/
+  Object **objects;             /*Pointer to Objects, ended by a NULL*/
+  Id *object_locations;         /*Where each object of objects is: the id of its space, CARRIED or NO_ID*/
+  Space **spaces;               /*Pointer to spaces, ended by a NULL*/
+  Link **links;                 /*Pointer to links, ended by a NULL*/
+  int n_enemies;                /*Number of enemies*/
+  int n_objects;                /*Number of objects*/
+  int n_spaces;                 /*Number of spaces*/
+  int n_links;                  /*Number of links*/
+  int max_enemies;              /*Allocated size of enemy*/
+  int max_objects;              /*Allocated size of objects*/
+  int max_spaces;               /*Allocated size of spaces*/
+  int max_links;                /*Allocated size of links*/
+  IdMap *enemy_ids;             /*Position of every enemy in enemy, by id*/
+  IdMap *object_ids;            /*Position of every object in objects, by id*/
+  IdMap *space_ids;             /*Position of every space in spaces, by id*/
+  IdMap *link_ids;              /*Position of every link in links, by id*/
+  NameIndex *object_names;      /*Objects by name, NULL until a name is looked for*/
+  ArtStore *art;                /*Graphic descriptions of the spaces, read when needed*/
+  struct _Levels *levels;       /*Levels of the world that are loaded, NULL if it is loaded whole*/
+  struct _Loader *loader;       /*Rest of the world being loaded in the background, NULL if it is all in*/
+  struct _SharedWorld *shared;  /*World whose spaces, links and objects it uses until it changes them, NULL if all are its own*/
   char description[MAX_S];      /*String of the inspect space/object*/
   T_Command last_cmd;           /*Structure commands*/
   STATUS cmd_st;                /*Command Status*/
@@ -54,7 +75,8 @@ STATUS game_create(Game *game);
  * @brief Updates the game with the last command given
  * @param game Pointer to structure Game
  * @param cmd Last command given
- * @return Ok if it can update the game, else it returns ERROR
+ * @return Ok if it can update the game, else it returns ERROR (the rest of the world or the levels around
+ * the player could not be loaded and the game cannot go on)
 */
 STATUS game_update(Game *game, T_Command cmd);
 
@@ -109,6 +131,22 @@ STATUS game_add_object(Game *game, Object *object);
 */
 STATUS game_add_link(Game *game, Link *link);
 
+/**
+ * @brief Removes a space from the game and destroys it
+ * @param game Pointer to structure Game
+ * @param id Space's ID
+ * @return OK if it removed the space, else, returns ERROR
+*/
+STATUS game_remove_space(Game *game, Id id);
+
+/**
+ * @brief Removes a link from the game and destroys it
+ * @param game Pointer to structure Game
+ * @param id Link's ID
+ * @return OK if it removed the link, else, returns ERROR
+*/
+STATUS game_remove_link(Game *game, Id id);
+
 /**
  * @brief Creates a new player
  * @param game Pointer to structure Game
@@ -125,6 +163,24 @@ STATUS game_add_player(Game *game, Player *player);
  */
 STATUS game_add_enemy(Game *game, Enemy *enemy);
 
+/**
+ * @brief Moves an enemy, to another space or to DEAD, keeping the enemies of the spaces in step
+ * @param game Pointer to structure Game
+ * @param enemy Pointer to structure Enemy, already in the game
+ * @param location Id of the space, DEAD or NO_ID
+ * @return OK if it moved the enemy, else, returns ERROR
+ */
+STATUS game_set_enemy_location(Game *game, Enemy *enemy, Id location);
+
+/**
+ * @brief Opens or closes a link
+ * @param game Pointer to structure Game
+ * @param id Link's ID
+ * @param open TRUE to open it, FALSE to close it
+ * @return OK if it changed the link, else, returns ERROR
+ */
+STATUS game_set_link_open(Game *game, Id id, BOOL open);
+
 /**
  * @brief It gets the position's id
  * @param game Pointer to structure Game
@@ -149,6 +205,32 @@ Space *game_get_space(Game *game, Id id);
 */
 Link *game_get_link(Game *game, Id id);
 
+/**
+ * @brief It resolves the exits of every space into pointers to their links and destinations, so
+ * moving and painting do not look them up by id. It must be called again when links are added or
+ * exits change; the ids stay as they are
+ * @param game Pointer to structure Game
+ * @return OK or ERROR
+*/
+STATUS game_resolve_links(Game *game);
+
+/**
+ * @brief Changes the name of an object of the game, so that it is found by its new name
+ * @param game Pointer to structure Game
+ * @param object Pointer to structure Object
+ * @param name new name
+ * @return OK or ERROR
+*/
+STATUS game_set_object_name(Game *game, Object *object, char *name);
+
+/**
+ * @brief Adds to the game the rest of the world that was being loaded in the background
+ * @param game Pointer to structure Game
+ * @param wait TRUE to wait until it is loaded, FALSE to do nothing if it is still loading
+ * @return OK or ERROR if the world could not be loaded
+*/
+STATUS game_finish_load(Game *game, BOOL wait);
+
 /**
  * @brief It gets an object from it's id
  * @param game Pointer to structure Game
@@ -180,6 +262,17 @@ Id game_get_player_location(Game *game);
 */
 Id game_get_object_location(Game *game, Id id);
 
+/**
+ * @brief It moves an object to a space, to the inventory of the player or out of the game. The
+ * object is put in its new place before it leaves the old one, so if it cannot be put there it
+ * stays where it was
+ * @param game Pointer to structure Game
+ * @param id Id of the object
+ * @param location Id of the space, CARRIED or NO_ID
+ * @return it returns OK if it goes well, else returns ERROR
+*/
+STATUS game_set_object_location(Game *game, Id id, Id location);
+
 /**
  * @brief It gets the last command from the imput
  * @param game Pointer to structure Game
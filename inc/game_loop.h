@@ -1,10 +1,13 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "graphic_engine.h"
 #include "game.h"
 #include "command.h"
 #include "game_reader.h"
+#include "watcher.h"
+#include "world_embed.h"
 
-int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name);
-void game_loop_run(Game game, Graphic_engine *gengine, FILE *glog);
+int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name, LOAD_MODE mode);
+void game_loop_run(Game *game, Graphic_engine *gengine, FILE *glog, Watcher *watcher);
 void game_loop_cleanup(Game game, Graphic_engine *gengine, FILE *glog);
\ No newline at end of file
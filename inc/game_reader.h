@@ -1,11 +1,35 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "game.h"
 #include "inventory.h"
+#include "strtab.h"
+#include "scan.h"
+#include "world.h"
+#include "world_bin.h"
+#include "levels.h"
+#include "loader.h"
+
+#define CACHE_EXT ".bin" /*!< Extension added to a data file to name its compiled copy */
+
+/**
+ * @brief How the data file is read
+ */
+typedef enum {
+  LOAD_STREAM,   /*!< Read line by line */
+  LOAD_MMAP,     /*!< Mapped in memory and parsed in place */
+  LOAD_PARALLEL, /*!< Mapped in memory and parsed in chunks by a pool of threads */
+  LOAD_CACHED,   /*!< Loaded from its compiled copy, which is made again if the file changed */
+  LOAD_LEVELS,   /*!< Mapped in memory, only the levels around the player are loaded */
+  LOAD_ASYNC     /*!< The player and its space are loaded first, the rest on a background thread */
+} LOAD_MODE;
 
 /**
- * @brief Plaze the object and the player at space 1
+ * @brief Creates the game and loads a data file into it, through its compiled copy when it is up to date
  * @param game Pointer to structure Game
  * @param filename Name of the file
  * @return Ok if it could create the game, else it returns ERROR.
@@ -13,40 +37,62 @@
 STATUS game_create_from_file(Game *game, char *filename);
 
 /**
- * @brief Initializes spaces and sets names to the spaces
+ * @brief Creates the game and loads a data file into it with the given loader
  * @param game Pointer to structure Game
  * @param filename Name of the file
- * @return OK if it could load space, else it returns ERROR
+ * @param mode Loader used to read the file
+ * @return Ok if it could create the game, else it returns ERROR.
 */
-STATUS game_load_spaces(Game *game, char *filename);
+STATUS game_create_from_file_mode(Game *game, char *filename, LOAD_MODE mode);
 
 /**
- * @brief Initializes objects and sets names to the objects
- * @param game Pointer to structure Game
+ * @brief Loads every space, object, player, enemy and link of a data file into the game
+ * @param game Pointer to structure Game, already created
  * @param filename Name of the file
- * @return OK if it could load objects, else it returns ERROR
+ * @return OK if it could load the file, else it returns ERROR
 */
-STATUS game_load_objects(Game *game, char *filename);
+STATUS game_load(Game *game, char *filename);
+
 /**
- * @brief Initializes spaces and sets names to the 
- * @param game Pointer to structure Game
+ * @brief Loads a data file like game_load, but mapping it in memory and parsing it in place
+ * @param game Pointer to structure Game, already created
  * @param filename Name of the file
- * @return OK if it could load player, else it returns ERROR
+ * @return OK if it could load the file, else it returns ERROR
 */
-STATUS game_load_player(Game *game, char *filename);
+STATUS game_load_mapped(Game *game, char *filename);
 
 /**
- * @brief Initializes an enemy and sets the name to it
- * @param game Pointer to structure Game
+ * @brief Loads a data file like game_load_mapped, parsing it in chunks on one thread per processor.
+ * The game ends up exactly as with the serial loaders
+ * @param game Pointer to structure Game, already created
  * @param filename Name of the file
- * @return OK if it could load enemy, else it returns ERROR
+ * @return OK if it could load the file, else it returns ERROR
 */
-STATUS game_load_enemy(Game *game, char *filename);
+STATUS game_load_parallel(Game *game, char *filename);
 
 /**
- * @brief Initializes a link and sets the names to the links
- * @param game Pointer to structure Game
+ * @brief Loads a data file from its compiled copy <filename>.bin if it was made from the current
+ * contents of the file. Otherwise it parses the file like game_load_mapped and writes the copy again
+ * @param game Pointer to structure Game, already created
+ * @param filename Name of the file
+ * @return OK if it could load the file, else it returns ERROR
+*/
+STATUS game_load_cached(Game *game, char *filename);
+
+/**
+ * @brief Loads the objects, players and enemies of a data file and only the levels around the player.
+ * The rest of the levels are loaded and unloaded by game_update as the player moves
+ * @param game Pointer to structure Game, already created
+ * @param filename Name of the file
+ * @return OK if it could load the file, else it returns ERROR
+*/
+STATUS game_load_levels(Game *game, char *filename);
+
+/**
+ * @brief Loads the first player of a data file and the space it is in, and starts loading the rest on a
+ * background thread. The rest is added by game_finish_load, which game_update calls when a command needs it
+ * @param game Pointer to structure Game, already created
  * @param filename Name of the file
- * @return OK if it could load links, else it returns ERROR
+ * @return OK if it could load the player and its space, else it returns ERROR
 */
-STATUS game_load_links(Game *game, char *filename);
+STATUS game_load_async(Game *game, char *filename);
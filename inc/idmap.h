@@ -0,0 +1,67 @@
+/**
+ * @brief It defines the id map interface
+ *
+ * An id map gives in constant time the position of an entity in a table
+ * from its id. It does not own the entities: whoever keeps the table must
+ * update the map when an entity is added, moved or removed.
+ *
+ * @file idmap.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef IDMAP_H
+#define IDMAP_H
+
+#include "types.h"
+
+/*Names the struct IdMap as a _IdMap structure*/
+typedef struct _IdMap IdMap;
+
+/**
+ * @brief allocates memory for a new, empty id map
+ * @return a Pointer to the new structure IdMap or NULL
+*/
+IdMap *idmap_create();
+
+/**
+ * @brief frees the map
+ * @param map Pointer to structure IdMap
+ * @return OK if it freed all or ERROR
+*/
+STATUS idmap_destroy(IdMap *map);
+
+/**
+ * @brief sets the position of an id, replacing the one it had
+ * @param map Pointer to structure IdMap
+ * @param id the id
+ * @param pos its position, not negative
+ * @return OK or ERROR
+*/
+STATUS idmap_put(IdMap *map, Id id, int pos);
+
+/**
+ * @brief gives the position of an id
+ * @param map Pointer to structure IdMap
+ * @param id the id
+ * @return its position, or -1 if it is not in the map
+*/
+int idmap_get(IdMap *map, Id id);
+
+/**
+ * @brief removes an id from the map
+ * @param map Pointer to structure IdMap
+ * @param id the id
+ * @return OK, or ERROR if it was not in the map
+*/
+STATUS idmap_remove(IdMap *map, Id id);
+
+/**
+ * @brief gives the number of ids in the map
+ * @param map Pointer to structure IdMap
+ * @return number of ids or -1
+*/
+int idmap_get_number(IdMap *map);
+
+#endif
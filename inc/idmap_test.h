@@ -0,0 +1,26 @@
+/** 
+ * @brief It declares the tests for the id map module
+ * 
+ * @file idmap_test.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+*/
+
+#ifndef IDMAP_TEST_H
+#define IDMAP_TEST_H
+
+void test1_idmap_create();
+void test1_idmap_destroy();
+void test2_idmap_destroy();
+void test1_idmap_put();
+void test2_idmap_put();
+void test3_idmap_put();
+void test1_idmap_get();
+void test2_idmap_get();
+void test1_idmap_remove();
+void test2_idmap_remove();
+void test1_idmap_get_number();
+void test2_idmap_get_number();
+
+#endif
@@ -13,6 +13,7 @@
 #include <stdio.h>
 #include "types.h"
 #include "set.h"
+#include "idmap.h"
 
 
 typedef struct _Inventory Inventory;
@@ -20,6 +21,10 @@ typedef struct _Inventory Inventory;
 
 Inventory *inventory_create();
 /*----------------------------------------------------------------------------------------------------*/
+Inventory *inventory_create_in(Arena *arena);
+/*----------------------------------------------------------------------------------------------------*/
+Inventory *inventory_copy_in(Arena *arena, Inventory *inv);
+/*----------------------------------------------------------------------------------------------------*/
 STATUS inventory_destroy(Inventory* inv);
 /*----------------------------------------------------------------------------------------------------*/
 BOOL inventory_isFull(Inventory* inv);
@@ -45,5 +50,15 @@ int inventory_print(FILE *pf, Inventory *inv);
 STATUS inventory_setCapacity(Inventory *inv, int capacity);
 /*----------------------------------------------------------------------------------------------------*/
 Set* inventory_getSet(Inventory *inv);
+/*----------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Keeps from now on a bitset of the objects, with one bit for every position of an id map, so
+ * inventory_contains, inventory_isFull and inventory_isEmpty do not look at the ids. The map must not
+ * move the objects while the inventory uses it, and outlive it and its copies
+ * @param inv Pointer to structure Inventory
+ * @param index Pointer to structure IdMap with the positions of the objects
+ * @return OK, or ERROR leaving it as it was if some object it has is not in the map
+*/
+STATUS inventory_setIndex(Inventory *inv, IdMap *index);
 
 #endif
\ No newline at end of file
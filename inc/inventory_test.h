@@ -36,6 +36,8 @@ void test2_inv_getIds();
 void test1_inv_setMaxObjs();
 void test2_inv_setMaxObjs();
 void test3_inv_setMaxObjs();
+void test1_inv_setIndex();
+void test2_inv_setIndex();
 
 
 #endif
\ No newline at end of file
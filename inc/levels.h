@@ -0,0 +1,94 @@
+/**
+ * @brief It defines the level streaming of a world
+ *
+ * The spaces of a world are grouped in levels by their id: every space whose
+ * id divided by LEVEL_ROOMS is the same is on the same level (1101 and 1122
+ * are on level 11). A link belongs to the level of its origin, and two
+ * levels are adjacent when a link goes from one to the other.
+ *
+ * Only the spaces and links of the level the player is on and of its
+ * adjacent levels are in the game. When the player moves to another level,
+ * the missing adjacent levels are loaded and the ones no longer adjacent are
+ * unloaded, keeping the state of their links and the objects left in their
+ * spaces. Objects, players and enemies are always in the game.
+ *
+ * When the player is in a space with a link to another level, the levels
+ * next to that one are parsed on a background thread, so that the move only
+ * has to create their entities. A level that was parsed keeps its records
+ * after being unloaded, until the data file is reloaded.
+ *
+ * @file levels.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef LEVELS_H
+#define LEVELS_H
+
+#include "game.h"
+
+#define LEVEL_ROOMS 100 /*!< Spaces whose ids only differ in the last two digits are on the same level */
+
+/*Names the struct Levels as a _Levels structure*/
+typedef struct _Levels Levels;
+
+/**
+ * @brief Maps a data file and splits its records in levels, without parsing them
+ * @param filename Name of the data file
+ * @return a Pointer to the new structure Levels or NULL
+ */
+Levels *levels_create(const char *filename);
+
+/**
+ * @brief Waits for the background thread and frees the levels. The entities already in a game are
+ * not destroyed
+ * @param levels Pointer to structure Levels
+ * @return OK or ERROR
+ */
+STATUS levels_destroy(Levels *levels);
+
+/**
+ * @brief Adds to the game every object, player and enemy, and the levels around the player
+ * @param levels Pointer to structure Levels
+ * @param game Pointer to structure Game, already created
+ * @return OK or ERROR
+ */
+STATUS levels_start(Levels *levels, Game *game);
+
+/**
+ * @brief Loads and unloads levels after the player moved, and starts parsing the levels the
+ * player may reach next
+ * @param levels Pointer to structure Levels
+ * @param game Pointer to structure Game
+ * @return OK or ERROR
+ */
+STATUS levels_update(Levels *levels, Game *game);
+
+/**
+ * @brief Maps the data file again after it was saved and splits it in levels again. Every level already
+ * parsed is parsed again from it: the art of its spaces is moved to where its lines now are, and its
+ * links keep the state the game left them in unless their records changed. The watcher calls it before
+ * patching the entities that are in the game
+ * @param levels Pointer to structure Levels
+ * @param game Pointer to structure Game
+ * @return OK or ERROR
+ */
+STATUS levels_reload(Levels *levels, Game *game);
+
+/**
+ * @brief Says if the spaces of a level are in the game
+ * @param levels Pointer to structure Levels
+ * @param level Number of the level, the id of its spaces divided by LEVEL_ROOMS
+ * @return TRUE if it is loaded
+ */
+BOOL levels_is_loaded(Levels *levels, long level);
+
+/**
+ * @brief Waits until the background thread, if any, has parsed its levels
+ * @param levels Pointer to structure Levels
+ * @return OK or ERROR
+ */
+STATUS levels_wait(Levels *levels);
+
+#endif
@@ -12,6 +12,8 @@
 #define LINK_H
 
 #include "types.h"
+#include "arena.h"
+#include "strtab.h"
 
 
 /**
@@ -25,6 +27,21 @@ typedef struct _Link Link;
  */
 Link *link_create();
 
+/**
+ * @brief Creates a link taking the memory from an arena
+ * @param arena the arena, or NULL to use the heap
+ * @return Pointer to structure link created
+ */
+Link *link_create_in(Arena *arena);
+
+/**
+ * @brief Creates a link equal to another one taking the memory from an arena
+ * @param arena the arena, or NULL to use the heap
+ * @param link Pointer to structure link to copy
+ * @return Pointer to structure link created
+ */
+Link *link_copy_in(Arena *arena, Link *link);
+
 /**
  * @brief Destroys a link
  * @param link Pointer to structure link to be destroyed
@@ -62,6 +79,13 @@ STATUS link_setName(Link *link, char *name);
  */
 const char *link_getName(Link *link);
 
+/**
+ * @brief Gets the handle of the name of a link, equal for equal names
+ * @param link Pointer to structure link
+ * @return the handle of the name in the table of the program, NO_STR if it has none
+ */
+StrId link_getNameId(Link *link);
+
 /**
  * @brief Sets the origin of a link
  * @param link Pointer to structure link
@@ -82,5 +82,6 @@ void test3_link_get_direction();
 void test1_link_set_direction();
 void test2_link_set_direction();
 void test3_link_set_direction();
+void test1_link_copy_in();
 
 #endif
\ No newline at end of file
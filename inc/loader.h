@@ -0,0 +1,56 @@
+/**
+ * @brief It defines the background loading of a world
+ *
+ * Only the player and the space where it starts are parsed before the game
+ * begins, so the first screen can be shown at once. The rest of the data
+ * file is parsed into a W_World on a background thread, which never touches
+ * the game: its entities are added by the game itself, once the thread has
+ * finished, when a command needs them or when it is seen to be done.
+ *
+ * @file loader.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef LOADER_H
+#define LOADER_H
+
+#include "game.h"
+
+/*Names the struct Loader as a _Loader structure*/
+typedef struct _Loader Loader;
+
+/**
+ * @brief Maps a data file, adds its first player and the space it is in to the game and starts
+ * parsing the rest on a background thread
+ * @param game Pointer to structure Game, already created
+ * @param filename Name of the data file
+ * @return a Pointer to the new structure Loader or NULL
+ */
+Loader *loader_start(Game *game, const char *filename);
+
+/**
+ * @brief Waits for the background thread and frees the loader. The entities already in a game are
+ * not destroyed
+ * @param loader Pointer to structure Loader
+ * @return OK or ERROR
+ */
+STATUS loader_destroy(Loader *loader);
+
+/**
+ * @brief Says if the background thread has finished, without waiting for it
+ * @param loader Pointer to structure Loader
+ * @return TRUE if the rest of the world is parsed
+ */
+BOOL loader_is_done(Loader *loader);
+
+/**
+ * @brief Waits for the background thread and adds to the game every entity it has not got yet
+ * @param loader Pointer to structure Loader
+ * @param game Pointer to structure Game
+ * @return OK or ERROR if the file could not be parsed
+ */
+STATUS loader_finish(Loader *loader, Game *game);
+
+#endif
@@ -0,0 +1,62 @@
+/**
+ * @brief It defines the name index interface
+ *
+ * A name index finds the id of an entity from its name as the player types
+ * it: without caring about upper and lower case, and from the start of the
+ * name as long as only one entity's name starts that way ("gra" finds
+ * "Grano"). Whole names are found through a hash table, and the starts of
+ * names through the names kept sorted.
+ *
+ * @file names.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef NAMES_H
+#define NAMES_H
+
+#include "types.h"
+
+/*Names the struct NameIndex as a _NameIndex structure*/
+typedef struct _NameIndex NameIndex;
+
+/**
+ * @brief allocates memory for a new, empty name index
+ * @return a Pointer to the new structure NameIndex or NULL
+*/
+NameIndex *names_create();
+
+/**
+ * @brief frees the index and the names copied in it
+ * @param index Pointer to structure NameIndex
+ * @return OK if it freed all or ERROR
+*/
+STATUS names_destroy(NameIndex *index);
+
+/**
+ * @brief adds a name, which is copied. If the same name was already added, the first id keeps being found
+ * @param index Pointer to structure NameIndex
+ * @param name the name
+ * @param id the id of the entity
+ * @return OK or ERROR
+*/
+STATUS names_add(NameIndex *index, const char *name, Id id);
+
+/**
+ * @brief finds an id by its whole name or, if no name is equal, by the start of a single name,
+ * without caring about case
+ * @param index Pointer to structure NameIndex
+ * @param name the name or its start
+ * @return the id, or NO_ID if no name matches or several names start that way
+*/
+Id names_find(NameIndex *index, const char *name);
+
+/**
+ * @brief gives the number of names added
+ * @param index Pointer to structure NameIndex
+ * @return number of names or -1
+*/
+int names_get_number(NameIndex *index);
+
+#endif
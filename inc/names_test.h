@@ -0,0 +1,26 @@
+/** 
+ * @brief It declares the tests for the name index module
+ * 
+ * @file names_test.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+*/
+
+#ifndef NAMES_TEST_H
+#define NAMES_TEST_H
+
+void test1_names_create();
+void test1_names_destroy();
+void test2_names_destroy();
+void test1_names_add();
+void test2_names_add();
+void test1_names_find();
+void test2_names_find();
+void test3_names_find();
+void test4_names_find();
+void test5_names_find();
+void test6_names_find();
+void test1_names_get_number();
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "types.h"
 #include "buff_debuff.h"
+#include "strtab.h"
 
 /**
  * @brief Object
@@ -18,6 +19,22 @@ typedef struct _Object Object;
   */
 Object* object_create(Id id);
 
+/**
+  * @brief It creates a new object taking the memory from an arena
+  * @param arena the arena, or NULL to use the heap
+  * @param id the identification number for the new object
+  * @return a new object, initialized
+  */
+Object* object_create_in(Arena *arena, Id id);
+
+/**
+  * @brief It creates a new object equal to another one, with its own buff and debuff, taking the memory from an arena
+  * @param arena the arena, or NULL to use the heap
+  * @param object a pointer to the object to copy
+  * @return a new object, or NULL
+  */
+Object* object_copy_in(Arena *arena, Object *object);
+
 /**
   * @brief It destroys an object, freeing the allocated memory
   * @param object a pointer to the space that must be destroyed  
@@ -55,6 +72,13 @@ STATUS object_set_name(Object* object, char* name);
   */
 const char* object_get_name(Object* object);
 
+/**
+  * @brief It gets the handle of the name of an object, equal for equal names
+  * @param object a pointer to the object
+  * @return the handle of the name in the table of the program, NO_STR if it has none
+  */
+StrId object_get_name_id(Object* object);
+
 /**
   * @brief It sets the name of an object
   * @param space a pointer to the object
@@ -96,6 +120,24 @@ BOOL object_getIfConsumable(Object* object);
 */
 STATUS object_setIfConsumable(Object* object, BOOL consumable);
 
+/**
+ * @brief It gets the type of an object
+ * 
+ * 
+ * @param object a pointer to the object
+ * @return the type of the object, or -1 if there was some mistake
+ */
+int object_getType(Object *object);
+
+/**
+ * @brief It sets the type of an object
+ * 
+ * 
+ * @param object a pointer to the object
+ * @param type the new type of the object
+ * @return OK if everything goes well, ERROR if there was some mistake
+*/
+STATUS object_setType(Object *object, BDTYPE type);
 
 BD *object_getBuff(Object *object);
 
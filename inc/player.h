@@ -29,6 +29,22 @@ typedef struct _Player Player;
 */
 Player *player_create(Id id);
 
+/**
+ * @brief It allocates a structure Player like player_create, taking the memory from an arena.
+ * @param arena the arena, or NULL to use the heap.
+ * @param id Id for the new player.
+ * @return returns a Pointer to the new Player if it goes without errors, else, it returns NULL.
+*/
+Player *player_create_in(Arena *arena, Id id);
+
+/**
+ * @brief It allocates a structure Player equal to another one, with its own inventory and xp, taking the memory from an arena.
+ * @param arena the arena, or NULL to use the heap.
+ * @param p Pointer to structure Player to copy.
+ * @return returns a Pointer to the new Player if it goes without errors, else, it returns NULL.
+*/
+Player *player_copy_in(Arena *arena, Player *p);
+
 /**
  * @brief It gives you the Player's Id.
  * @param p Pointer to structure Player.
@@ -50,10 +66,17 @@ STATUS player_setId(Player *p, Id id);
  * @brief It gives the Player's name.
  * @param p Pointer to structure Player.
  * @author Miguel Paterson.
- * @return returns the Player's name, else, it returns NULL.
+ * @return returns the Player's name, which must not be changed, else, it returns NULL.
 */
 char *player_getName(Player *p);
 
+/**
+ * @brief It gives the handle of the Player's name, equal for equal names.
+ * @param p Pointer to structure Player.
+ * @return returns the handle of the name in the table of the program, NO_STR if it has none.
+*/
+StrId player_getNameId(Player *p);
+
 /**
  * @brief It changes the Player's name.
  * @param p Pointer to structure Player.
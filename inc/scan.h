@@ -0,0 +1,67 @@
+/**
+ * @brief It defines the record tokenizer used by the loaders
+ *
+ * A record is a line of fields separated by '|'. The tokenizer looks for the
+ * delimiters a block of bytes at a time with SIMD compares (AVX2 or SSE2,
+ * chosen when the program starts) and falls back to a byte loop on other
+ * machines and for the last bytes of a line.
+ *
+ * Numbers are parsed by hand instead of with atol and atof, so they do not
+ * depend on the locale: a float may use either '.' or ',' as its decimal
+ * separator.
+ *
+ * @file scan.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef SCAN_H
+#define SCAN_H
+
+#include <stddef.h>
+
+/**
+ * @brief A field of a record, it points into the record and is not NUL terminated
+ */
+typedef struct {
+  const char *s; /*!< First character of the field */
+  int len;       /*!< Number of characters */
+} ScanField;
+
+/**
+ * @brief Splits a record in fields separated by '|', skipping empty ones like strtok does. It stops
+ * at the first end of line. Fields missing at the end are left empty, pointing to where it stopped
+ * @param p First character of the record, after its tag
+ * @param end End of the data, the record does not need to be NUL terminated
+ * @param fields Where the fields are stored
+ * @param max Number of fields wanted, the rest are ignored
+ * @return number of fields found
+ */
+int scan_fields(const char *p, const char *end, ScanField *fields, int max);
+
+/**
+ * @brief Parses an integer, with optional blanks and sign before it, stopping at the first character
+ * that is not a digit
+ * @param s First character
+ * @param len Number of characters that may be read
+ * @return the number, 0 if there is none
+ */
+long scan_long(const char *s, size_t len);
+
+/**
+ * @brief Parses a float the same way whatever the locale is. The decimal separator can be '.' or ','
+ * and an exponent may follow
+ * @param s First character
+ * @param len Number of characters that may be read
+ * @return the number, 0 if there is none
+ */
+float scan_float(const char *s, size_t len);
+
+/**
+ * @brief Gives the name of the instruction set used to look for delimiters
+ * @return "avx2", "sse2" or "scalar"
+ */
+const char *scan_isa();
+
+#endif
@@ -0,0 +1,25 @@
+/** 
+ * @brief It declares the tests for the record tokenizer
+ * 
+ * @file scan_test.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+*/
+
+#ifndef SCAN_TEST_H
+#define SCAN_TEST_H
+
+void test1_scan_fields();
+void test2_scan_fields();
+void test3_scan_fields();
+void test4_scan_fields();
+void test5_scan_fields();
+void test1_scan_long();
+void test2_scan_long();
+void test1_scan_float();
+void test2_scan_float();
+void test3_scan_float();
+void test4_scan_float();
+
+#endif
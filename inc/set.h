@@ -12,16 +12,40 @@
 
 #include <stdio.h>
 #include "types.h"
+#include "arena.h"
 
 /*Names the struct Set as a _Set structure*/
 typedef struct _Set Set;
 
+/**
+ * @brief Function called by set_foreach for every id
+ * @param id id of the set
+ * @param data Pointer given to set_foreach
+ * @return TRUE to go on with the next id, FALSE to stop
+*/
+typedef BOOL (*set_fn)(Id id, void *data);
+
 /**
  * @brief allocates memory for a new set structure
  * @return a Pointer to the new structure Set
 */
 Set *set_create();
 
+/**
+ * @brief allocates memory for a new set structure in an arena, which its ids will also come from
+ * @param arena Pointer to structure Arena, or NULL to use the heap
+ * @return a Pointer to the new structure Set
+*/
+Set *set_create_in(Arena *arena);
+
+/**
+ * @brief allocates memory for a new set with the same ids as another one
+ * @param arena Pointer to structure Arena the copy comes from, or NULL to use the heap
+ * @param s Pointer to structure Set to copy
+ * @return a Pointer to the new structure Set or NULL
+*/
+Set *set_copy_in(Arena *arena, Set *s);
+
 /**
  * @brief frees all the memory allocated for the set
  * @param s Pointer to structure Set
@@ -53,6 +77,49 @@ STATUS set_del(Set *s, Id id);
 */
 BOOL set_contains(Set *s, Id id);
 
+/**
+ * @brief adds to a set every id of another one
+ * @param s Pointer to structure Set that changes
+ * @param other Pointer to structure Set whose ids are added
+ * @return OK, or ERROR if some id could not be added
+*/
+STATUS set_union(Set *s, Set *other);
+
+/**
+ * @brief deletes from a set every id that is not in another one
+ * @param s Pointer to structure Set that changes
+ * @param other Pointer to structure Set with the ids that are kept
+ * @return OK or ERROR
+*/
+STATUS set_intersect(Set *s, Set *other);
+
+/**
+ * @brief deletes from a set every id that is in another one
+ * @param s Pointer to structure Set that changes
+ * @param other Pointer to structure Set with the ids that are deleted
+ * @return OK or ERROR
+*/
+STATUS set_difference(Set *s, Set *other);
+
+/**
+ * @brief says whether two sets have some id in common, looking up the ids of the smaller one in the
+ * other without building any set
+ * @param s Pointer to structure Set
+ * @param other Pointer to structure Set
+ * @return TRUE if some id is in both or FALSE
+*/
+BOOL set_contains_any(Set *s, Set *other);
+
+/**
+ * @brief calls a function for every id of the set, in the order of set_get_ids, until it returns
+ * FALSE. The function must not change the set
+ * @param s Pointer to structure Set
+ * @param fn function to call
+ * @param data Pointer given to every call
+ * @return number of ids the function was called for, -1 if there was some mistake
+*/
+int set_foreach(Set *s, set_fn fn, void *data);
+
 /**
  * @brief it gives a dinamic array of all ids contained
  * @param s Pointer to structure Set
@@ -28,6 +28,15 @@ void test1_set_contains();
 void test2_set_contains();
 void test1_set_get_numberofIds();
 void test2_set_get_numberofIds();
+void test1_set_copy_in();
+void test2_set_copy_in();
+void test4_set_add();
+void test4_set_del();
+void test1_set_union();
+void test1_set_intersect();
+void test1_set_difference();
+void test1_set_contains_any();
+void test1_set_foreach();
 void test1_set_destroy();
 void test2_set_destroy();
 
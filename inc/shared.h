@@ -0,0 +1,112 @@
+/**
+ * @brief It defines a world shared by many games
+ *
+ * A shared world is a game that is loaded once and never played. Any number
+ * of sessions, games made from it with game_create_session, use its spaces,
+ * objects and links in place, together with its maps of ids and its art.
+ * Each session only has its own player, its own enemies, where its objects
+ * are and the tables that point to the entities.
+ *
+ * The first time a session changes a space, a link or an object (an object
+ * dropped or taken, a door opened, an enemy killed) it makes its own copy of
+ * it in its arena and points its table to the copy, so the world and the
+ * rest of the sessions never see the change.
+ *
+ * A session can be cloned: the clone shares with the world whatever the
+ * session still shares, copies what the session made its own, and can be
+ * set back to the state of the session as many times as needed, taking its
+ * memory again from the same block of its arena.
+ *
+ * The world is freed when it has been released by whoever made it and every
+ * session made from it, clones included, has been destroyed. The sessions of a world share its
+ * art store, so they must all be used from the same thread.
+ *
+ * @file shared.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef SHARED_H
+#define SHARED_H
+
+#include "game.h"
+
+/*Names the struct SharedWorld as a _SharedWorld structure*/
+typedef struct _SharedWorld SharedWorld;
+
+/**
+ * @brief Makes a loaded game the world of new sessions. The rest of the world is loaded first if it
+ * was being loaded in the background, and a world streamed by levels cannot be shared
+ * @param game Pointer to structure Game, loaded. If it is shared, it belongs to the world and must
+ * not be used or destroyed any more
+ * @return a Pointer to the new structure SharedWorld, or NULL leaving the game as it was
+ */
+SharedWorld *shared_create(Game *game);
+
+/**
+ * @brief Gives up the reference of who made the world, which is freed when no session uses it
+ * @param world Pointer to structure SharedWorld
+ * @return OK or ERROR
+ */
+STATUS shared_release(SharedWorld *world);
+
+/**
+ * @brief Takes a session out of the world, freeing the world if it was the last one and the world was
+ * released. game_destroy does it for every session
+ * @param world Pointer to structure SharedWorld
+ * @return OK or ERROR
+ */
+STATUS shared_remove_session(SharedWorld *world);
+
+/**
+ * @brief Gives the game the world was made from, which must only be read
+ * @param world Pointer to structure SharedWorld
+ * @return the game or NULL
+ */
+Game *shared_get_game(SharedWorld *world);
+
+/**
+ * @brief Gives the number of sessions made from the world that have not been destroyed
+ * @param world Pointer to structure SharedWorld
+ * @return the number of sessions, -1 if there was some mistake
+ */
+int shared_get_sessions(SharedWorld *world);
+
+/**
+ * @brief Creates a game that starts as the world is and shares its entities until it changes them.
+ * It is destroyed with game_destroy
+ * @param game Pointer to structure Game
+ * @param world Pointer to structure SharedWorld
+ * @return OK if it could create the game, else it returns ERROR
+ */
+STATUS game_create_session(Game *game, SharedWorld *world);
+
+/**
+ * @brief Creates a session of a world that is as another session is now: same player, enemies, objects
+ * and links. It is destroyed with game_destroy
+ * @param clone Pointer to structure Game to create
+ * @param game Pointer to structure Game to copy, a session of a world
+ * @return OK if it could create the clone, else it returns ERROR
+ */
+STATUS game_clone(Game *clone, const Game *game);
+
+/**
+ * @brief Makes a session, usually a clone, be again as another session of the same world is now,
+ * undoing everything that was done to it. If it fails, the clone can only be destroyed
+ * @param clone Pointer to structure Game to set back
+ * @param game Pointer to structure Game to copy
+ * @return OK or ERROR
+ */
+STATUS game_restore(Game *clone, const Game *game);
+
+/**
+ * @brief Copies a space into the arena of a session, with the enemies and the links of the session in
+ * it instead of those of the game the space comes from
+ * @param game Pointer to structure Game, a session
+ * @param space Pointer to structure Space
+ * @return the copy or NULL
+ */
+Space *shared_copy_space(Game *game, Space *space);
+
+#endif
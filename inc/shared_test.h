@@ -0,0 +1,28 @@
+/** 
+ * @brief It declares the tests for the shared world module
+ * 
+ * @file shared_test.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+*/
+
+#ifndef SHARED_TEST_H
+#define SHARED_TEST_H
+
+void test1_shared_create();
+void test2_shared_create();
+void test1_game_create_session();
+void test2_game_create_session();
+void test3_game_create_session();
+void test4_game_create_session();
+void test5_game_create_session();
+void test1_game_clone();
+void test2_game_clone();
+void test1_game_restore();
+void test2_game_restore();
+void test1_shared_remove_session();
+void test1_shared_release();
+void test2_shared_release();
+
+#endif
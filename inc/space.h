@@ -14,12 +14,14 @@
 #include "types.h"
 #include "object.h"
 #include "set.h"
+#include "art.h"
+#include "link.h"
+#include "enemy.h"
+#include "strtab.h"
 
 typedef struct _Space Space;
 
-#define MAX_SPACES 100
 #define FIRST_SPACE 1
-#define GDESC 5
 
 /**
   * @brief It creates a new space, allocating memory and initializing its memebers
@@ -30,6 +32,25 @@ typedef struct _Space Space;
   */
 Space* space_create(Id id);
 
+/**
+  * @brief It creates a new space in an arena, which its objects and enemies will also come from
+  *
+  * @param arena the arena, or NULL to use the heap
+  * @param id the identification number for the new space
+  * @return a new space, initialized
+  */
+Space* space_create_in(Arena *arena, Id id);
+
+/**
+  * @brief It creates a new space equal to another one in an arena. The copy has its own objects and
+  * list of enemies, with the same enemies in it, and it shares its links, neighbours and art
+  *
+  * @param arena the arena, or NULL to use the heap
+  * @param space a pointer to the space to copy
+  * @return a new space, or NULL
+  */
+Space* space_copy_in(Arena *arena, Space *space);
+
 /**
   * @brief It destroys a space, freeing the allocated memory
   * @author Profesores PPROG
@@ -67,6 +88,14 @@ STATUS space_set_name(Space* space, char* name);
   */
 const char* space_get_name(Space* space);
 
+/**
+  * @brief It gets the handle of the name of a space, equal for equal names
+  * 
+  * @param space a pointer to the space
+  * @return the handle of the name in the table of the program, NO_STR if it has none
+  */
+StrId space_get_name_id(Space* space);
+
 /**
   * @brief It sets the description of a space
   * @author Rafael Romero
@@ -82,7 +111,7 @@ STATUS space_set_desc(Space* space, char* desc);
   * @author Rafael Romero
   * 
   * @param space a pointer to the space
-  * @return  a string with the description of the space
+  * @return  a string with the description of the space, which must not be changed
   */
 
 char *space_get_desc(Space* space);
@@ -158,6 +187,36 @@ STATUS space_set_west(Space* space, Id id);
   */
 Id space_get_west(Space* space);
 
+/**
+  * @brief It sets the link of a space in a direction, resolved from the id of the exit, and the space it leads to.
+  * Setting the id of an exit again clears them
+  *
+  * @param space a pointer to the space
+  * @param dir the direction
+  * @param link the link, or NULL
+  * @param neighbour the destination of the link, or NULL
+  * @return OK, if everything goes well or ERROR if there was some mistake
+  */
+STATUS space_set_link(Space* space, DIRECTION dir, Link *link, Space *neighbour);
+
+/**
+  * @brief It gets the link of a space in a direction
+  *
+  * @param space a pointer to the space
+  * @param dir the direction
+  * @return the link or NULL if there is none or it was not resolved
+  */
+Link *space_get_link(Space* space, DIRECTION dir);
+
+/**
+  * @brief It gets the space the link of a space in a direction leads to
+  *
+  * @param space a pointer to the space
+  * @param dir the direction
+  * @return the space or NULL if there is none or it was not resolved
+  */
+Space *space_get_neighbour(Space* space, DIRECTION dir);
+
 /**
   * @brief It adds an object not contained in the space
   * @author Miguel Paterson
@@ -208,23 +267,104 @@ Id *space_get_objects(Space *space);
 Set *space_get_set(Space *space);
 
 /**
-  * @brief It sets the description of a space
+  * @brief It puts an enemy in the space, after the ones already there
+  *
+  * @param space a pointer to the space
+  * @param enemy the enemy, which must be taken out before it is destroyed
+  * @return OK, if everything goes well or ERROR if it was already there or there was some mistake
+  */
+STATUS space_add_enemy(Space *space, Enemy *enemy);
+
+/**
+  * @brief It takes an enemy out of the space, keeping the order of the rest
   *
   * @param space a pointer to the space
-  * @param gdesd a description of the space
-  * @param i number of a char of the string gdesc
+  * @param enemy the enemy
+  * @return OK, if everything goes well or ERROR if it was not there
+  */
+STATUS space_delete_enemy(Space *space, Enemy *enemy);
+
+/**
+  * @brief It gets the first enemy in the space
+  *
+  * @param space a pointer to the space
+  * @return the enemy or NULL if there is none
+  */
+Enemy *space_get_enemy(Space *space);
+
+/**
+  * @brief It gets one of the enemies in the space
+  *
+  * @param space a pointer to the space
+  * @param i position of the enemy, from 0 in the order they came in
+  * @return the enemy or NULL if there is none at that position
+  */
+Enemy *space_get_enemy_at(Space *space, int i);
+
+/**
+  * @brief It gets how many enemies are in the space
+  *
+  * @param space a pointer to the space
+  * @return the number of enemies or -1 if there was some mistake
+  */
+int space_get_number_of_enemies(Space *space);
+
+/**
+  * @brief It sets a line of the graphic description of a space that has no art store. Equal lines of
+  * any space are kept once, in the table of the program
+  *
+  * @param space a pointer to the space
+  * @param gdesd the line
+  * @param i number of the line
+  * @return OK, if everything goes well or ERROR if there was some mistake
   */
 STATUS space_set_gdesc(Space *space, char *gdesc, int i);
 
 
 /**
-  * @brief It gets the description of a space
+  * @brief It gets the description of a space, reading it from the art store if the space has one
   *
   * @param space a pointer to the space
-  * @param i number of a char of the string gdesc
+  * @param i number of the line
+  * @return the line, shared with the spaces that have the same one, or NULL if the space has not that line
   */
 const char * space_get_gdesc(Space *space, int i);
 
+/**
+  * @brief It makes the graphic description of a space come from an art store
+  *
+  * @param space a pointer to the space
+  * @param store the art store, which must outlive the space
+  * @param art number of the art in the store
+  * @return OK, if everything goes well or ERROR if there was some mistake
+  */
+STATUS space_set_art(Space *space, ArtStore *store, int art);
+
+/**
+  * @brief It gets the number of the graphic description of a space in its art store
+  *
+  * @param space a pointer to the space
+  * @return the number of the art or -1 if the space has none
+  */
+int space_get_art(Space *space);
+
+/**
+  * @brief It sets the number of lines of the graphic description of a space
+  *
+  * @param space a pointer to the space
+  * @param nlines number of lines
+  * @return OK, if everything goes well or ERROR if there was some mistake
+  */
+STATUS space_set_nlines(Space *space, int nlines);
+
+/**
+  * @brief It gets the number of lines of the graphic description of a space
+  *
+  * @param space a pointer to the space
+  * @return the number of lines or -1 if there was some mistake
+  */
+int space_get_nlines(Space *space);
+
 
 /**
   * @brief It prints the space information
@@ -84,5 +84,14 @@ void test3_space_get_objects();
 void test1_space_delete_object();
 void test2_space_delete_object();
 void test3_space_delete_object();
+void test1_space_get_link();
+void test2_space_get_link();
+void test3_space_get_link();
+void test1_space_add_enemy();
+void test2_space_add_enemy();
+void test1_space_delete_enemy();
+void test1_space_copy_in();
+void test1_space_set_gdesc();
+void test2_space_set_gdesc();
 
 #endif
\ No newline at end of file
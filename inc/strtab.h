@@ -0,0 +1,77 @@
+/**
+ * @brief It defines the string table interface
+ *
+ * A string table interns strings: every distinct string is stored once and
+ * the same pointer is returned for every later request of an equal string.
+ * Returned pointers stay valid until the table is destroyed.
+ *
+ * There is also one table for the whole program, where the names and
+ * descriptions of the entities are kept. Each of its strings has a handle
+ * of 4 bytes, given by strtab_id and turned back into the string by
+ * strtab_str, so equal strings have equal handles. Its strings are never
+ * freed. strtab_id can be called from any thread.
+ *
+ * @file strtab.h
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef STRTAB_H
+#define STRTAB_H
+
+#include "types.h"
+
+/*Names the struct StrTab as a _StrTab structure*/
+typedef struct _StrTab StrTab;
+
+/*Handle of a string of the table of the program, 0 is the empty string*/
+typedef unsigned int StrId;
+
+#define NO_STR 0
+
+/**
+ * @brief allocates memory for a new, empty string table
+ * @return a Pointer to the new structure StrTab or NULL
+*/
+StrTab *strtab_create();
+
+/**
+ * @brief frees the table and every string stored in it
+ * @param t Pointer to structure StrTab
+ * @return OK if it freed all or ERROR
+*/
+STATUS strtab_destroy(StrTab *t);
+
+/**
+ * @brief interns a string given as a (pointer, length) view, it does not need to be NUL terminated
+ * @param t Pointer to structure StrTab
+ * @param s first character of the string
+ * @param len number of characters of the string
+ * @return a NUL terminated copy owned by the table, equal strings share the same pointer, NULL on error
+*/
+const char *strtab_intern(StrTab *t, const char *s, int len);
+
+/**
+ * @brief gives the number of distinct strings stored
+ * @param t Pointer to structure StrTab
+ * @return number of strings or -1
+*/
+int strtab_get_number(StrTab *t);
+
+/**
+ * @brief interns a string in the table of the program
+ * @param s NUL terminated string
+ * @return its handle, the same for equal strings, NO_STR for the empty string or on error
+*/
+StrId strtab_id(const char *s);
+
+/**
+ * @brief gives the string of a handle of the table of the program. The handle must have been given
+ * to this thread, or to one that handed it over through a lock or by starting or joining it
+ * @param id handle given by strtab_id
+ * @return the NUL terminated string, which must not be changed, or "" if the handle is not valid
+*/
+const char *strtab_str(StrId id);
+
+#endif
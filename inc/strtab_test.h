@@ -0,0 +1,27 @@
+/** 
+ * @brief It declares the tests for the string table module
+ * 
+ * @file strtab_test.h
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+*/
+
+#ifndef STRTAB_TEST_H
+#define STRTAB_TEST_H
+
+void test1_strtab_create();
+void test1_strtab_destroy();
+void test2_strtab_destroy();
+void test1_strtab_intern();
+void test2_strtab_intern();
+void test3_strtab_intern();
+void test4_strtab_intern();
+void test5_strtab_intern();
+void test1_strtab_get_number();
+void test2_strtab_get_number();
+void test1_strtab_id();
+void test2_strtab_id();
+void test1_strtab_str();
+
+#endif
@@ -0,0 +1,67 @@
+/**
+ * @brief It defines the data file watcher
+ *
+ * A watcher follows the data file of a running game with inotify and, when
+ * it is saved again, applies the changes to the game without restarting it.
+ * It keeps a hash of the text of every record; on a reload only the records
+ * whose hash changed are parsed and patched into the game with the
+ * world_patch_* functions. Records added to or removed from the file are
+ * ignored until the game is started again. Where every object and enemy
+ * starts is kept too, so a reload only moves or heals those the session
+ * has left as they were.
+ *
+ * @file watcher.h
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef WATCHER_H
+#define WATCHER_H
+
+#include "game.h"
+
+/*Names the struct Watcher as a _Watcher structure*/
+typedef struct _Watcher Watcher;
+
+/**
+ * @brief Starts watching a data file and hashes its records
+ * @param filename Name of the data file the game was loaded from
+ * @return a Pointer to the new structure Watcher or NULL
+ */
+Watcher *watcher_create(const char *filename);
+
+/**
+ * @brief Stops watching the data file
+ * @param watcher Pointer to structure Watcher
+ * @return OK or ERROR
+ */
+STATUS watcher_destroy(Watcher *watcher);
+
+/**
+ * @brief Checks, without waiting, if the data file was saved again and if so applies its changes
+ * to the game
+ * @param watcher Pointer to structure Watcher
+ * @param game Pointer to structure Game
+ * @return OK if there was nothing to do or the changes were applied, ERROR if the file could not be read
+ */
+STATUS watcher_poll(Watcher *watcher, Game *game);
+
+/**
+ * @brief Applies to the game the changes of the data file since the last reload, whether or not it
+ * was notified
+ * @param watcher Pointer to structure Watcher
+ * @param game Pointer to structure Game
+ * @return OK or ERROR
+ */
+STATUS watcher_reload(Watcher *watcher, Game *game);
+
+/**
+ * @brief Gives the number of records that were patched into the game on the last reload. A changed
+ * record of an entity that is not in the game is not counted
+ * @param watcher Pointer to structure Watcher
+ * @return number of records or -1
+ */
+int watcher_get_changes(Watcher *watcher);
+
+#endif
@@ -0,0 +1,297 @@
+/**
+ * @brief It defines the world records read from a data file
+ *
+ * Every loader turns the records of a data file into these plain structures
+ * and hands them to the world_add_* functions, which create the entities and
+ * add them to the game. References to spaces are queued in W_Fixups and
+ * resolved by world_fixup once every space has been added.
+ *
+ * A whole data file can also be kept in memory as a W_World, the list of all
+ * its records in file order, which can be applied to a game or compiled.
+ * The graphic description of the spaces is not copied: only its position in
+ * the file is recorded, and the game reads it when a space is first shown.
+ *
+ * @file world.h
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <stddef.h>
+#include "game.h"
+#include "inventory.h"
+#include "strtab.h"
+
+/**
+ * @brief Space record (#s:)
+ */
+typedef struct {
+  Id id;              /*!< Id of the space */
+  const char *name;   /*!< Name of the space */
+  int nlines;         /*!< Number of lines of the graphic description */
+  long offset;        /*!< Position of its first line in the data file, -1 if unknown */
+  const char *const *gdesc; /*!< Lines of the graphic description, NULL if they are read when needed */
+} W_Space;
+
+/**
+ * @brief Object record (#o:)
+ */
+typedef struct {
+  Id id;              /*!< Id of the object */
+  const char *name;   /*!< Name of the object */
+  Id location;        /*!< Space where the object is */
+  int type;           /*!< Rarity of the object */
+  int buff_type;      /*!< Type of the buff */
+  float buff_value;   /*!< Value of the buff */
+  int debuff_type;    /*!< Type of the debuff */
+  float debuff_value; /*!< Value of the debuff */
+  BOOL consumable;    /*!< If the object is consumable or not */
+  int i;              /*!< Row of the object inside the space */
+  int j;              /*!< Column of the object inside the space */
+} W_Object;
+
+/**
+ * @brief Player record (#p:)
+ */
+typedef struct {
+  Id id;            /*!< Id of the player */
+  const char *name; /*!< Name of the player */
+  Id location;      /*!< Space where the player is */
+  int health;       /*!< Health of the player */
+  int capacity;     /*!< Capacity of the inventory */
+  float attack;     /*!< Attack of the player */
+  float defense;    /*!< Defense of the player */
+  int i;            /*!< Row of the player inside the space */
+  int j;            /*!< Column of the player inside the space */
+} W_Player;
+
+/**
+ * @brief Enemy record (#e:)
+ */
+typedef struct {
+  Id id;            /*!< Id of the enemy */
+  const char *name; /*!< Name of the enemy */
+  Id location;      /*!< Space where the enemy is */
+  int health;       /*!< Health of the enemy */
+  float attack;     /*!< Attack of the enemy */
+  float defense;    /*!< Defense of the enemy */
+  int i;            /*!< Row of the enemy inside the space */
+  int j;            /*!< Column of the enemy inside the space */
+} W_Enemy;
+
+/**
+ * @brief Link record (#l:)
+ */
+typedef struct {
+  Id id;            /*!< Id of the link */
+  const char *name; /*!< Name of the link */
+  Id origin;        /*!< Space where the link starts */
+  Id destination;   /*!< Space where the link ends */
+  DIRECTION dir;    /*!< Direction of the link in its origin */
+  BOOL open;        /*!< Open or closed */
+  Id requirement;   /*!< Object or enemy needed to open it */
+} W_Link;
+
+/**
+ * @brief A pending reference from an object or a link to a space
+ */
+typedef struct {
+  Id id;         /*!< Id of the object or link */
+  Id space;      /*!< Id of the space it refers to */
+  DIRECTION dir; /*!< Direction of the link in its origin (links only) */
+} W_Fixup;
+
+/**
+ * @brief Growable list of pending references
+ */
+typedef struct {
+  W_Fixup *items; /*!< Pending references */
+  int n;          /*!< Number of pending references */
+  int max;        /*!< Allocated size */
+} W_Fixups;
+
+/**
+ * @brief Every record of a data file, in file order
+ */
+typedef struct _W_World {
+  W_Space *spaces;         /*!< Space records */
+  int n_spaces;            /*!< Number of space records */
+  W_Object *objects;       /*!< Object records */
+  int n_objects;           /*!< Number of object records */
+  W_Player *players;       /*!< Player records */
+  int n_players;           /*!< Number of player records */
+  W_Enemy *enemies;        /*!< Enemy records */
+  int n_enemies;           /*!< Number of enemy records */
+  W_Link *links;           /*!< Link records */
+  int n_links;             /*!< Number of link records */
+  StrTab *strings;         /*!< Table owning the names */
+  int max[5];              /*!< Allocated size of each array */
+  struct _W_World **parts; /*!< Worlds the records were merged from, they own their strings */
+  int n_parts;             /*!< Number of parts */
+} W_World;
+
+/**
+ * @brief Creates an empty world with its own string table
+ * @return the new world or NULL
+ */
+W_World *world_create();
+
+/**
+ * @brief Frees a world created by world_create and every string it owns
+ * @param w Pointer to the world
+ * @return OK or ERROR
+ */
+STATUS world_destroy(W_World *w);
+
+/**
+ * @brief Adds to a world the records of a data file held in memory. The buffer is not modified,
+ * it does not need to be NUL terminated and it can be freed once the call returns
+ * @param w Pointer to the world
+ * @param data Contents of the data file
+ * @param size Number of characters
+ * @return OK or ERROR
+ */
+STATUS world_parse(W_World *w, const char *data, size_t size);
+
+/**
+ * @brief Adds to a world the records of a data file held in memory like world_parse, splitting the
+ * data in chunks at record boundaries that are parsed by a pool of threads. The records end up in
+ * the same order as with world_parse
+ * @param w Pointer to the world
+ * @param data Contents of the data file
+ * @param size Number of characters
+ * @param nthreads Number of threads, 0 to use one per processor
+ * @return OK or ERROR
+ */
+STATUS world_parse_parallel(W_World *w, const char *data, size_t size, int nthreads);
+
+/**
+ * @brief Creates every entity of the world and adds it to the game, then resolves the references
+ * @param w Pointer to the world
+ * @param game Pointer to structure Game, already created
+ * @return OK or ERROR
+ */
+STATUS world_apply(const W_World *w, Game *game);
+
+/**
+ * @brief Creates a space from its record in the arena of the game, without adding it to the game
+ * @param game Pointer to structure Game
+ * @param rec Space record
+ * @return the new space or NULL
+ */
+Space *world_new_space(Game *game, const W_Space *rec);
+
+/**
+ * @brief Creates a space from its record and adds it to the game. If the game has an art store, the
+ * art is recorded there: the lines of the record are used in place, so they must last as long as the
+ * game, and without lines the art is read from the data file when needed
+ * @param game Pointer to structure Game
+ * @param rec Space record
+ * @return OK or ERROR
+ */
+STATUS world_add_space(Game *game, const W_Space *rec);
+
+/**
+ * @brief Creates an object from its record, adds it to the game and queues its placement
+ * @param game Pointer to structure Game
+ * @param rec Object record
+ * @param placed List where the placement of the object is queued, NULL if the caller places it
+ * @return OK or ERROR
+ */
+STATUS world_add_object(Game *game, const W_Object *rec, W_Fixups *placed);
+
+/**
+ * @brief Creates the player from its record and adds it to the game
+ * @param game Pointer to structure Game
+ * @param rec Player record
+ * @return OK or ERROR
+ */
+STATUS world_add_player(Game *game, const W_Player *rec);
+
+/**
+ * @brief Creates an enemy from its record and adds it to the game
+ * @param game Pointer to structure Game
+ * @param rec Enemy record
+ * @return OK or ERROR
+ */
+STATUS world_add_enemy(Game *game, const W_Enemy *rec);
+
+/**
+ * @brief Creates a link from its record, adds it to the game and queues its attachment to the origin
+ * @param game Pointer to structure Game
+ * @param rec Link record
+ * @param attached List where the attachment of the link is queued, NULL if the caller attaches it
+ * @return OK or ERROR
+ */
+STATUS world_add_link(Game *game, const W_Link *rec, W_Fixups *attached);
+
+/**
+ * @brief Queues a reference to a space, to be resolved by world_fixup
+ * @param f List of pending references
+ * @param id Id of the object or link
+ * @param space Id of the space it refers to
+ * @param dir Direction of the link in its origin, Unkown for objects
+ * @return OK or ERROR
+ */
+STATUS world_queue(W_Fixups *f, Id id, Id space, DIRECTION dir);
+
+/**
+ * @brief Resolves the queued references once every space has been added, and empties the lists.
+ * Enemies added before their space are put in it too
+ * @param game Pointer to structure Game
+ * @param placed Queued object placements
+ * @param attached Queued link attachments
+ */
+void world_fixup(Game *game, W_Fixups *placed, W_Fixups *attached);
+
+/**
+ * @brief Updates a space of the game from a changed record: name and graphic description
+ * @param game Pointer to structure Game
+ * @param rec Space record
+ * @return OK or ERROR if the space is not in the game
+ */
+STATUS world_patch_space(Game *game, const W_Space *rec);
+
+/**
+ * @brief Updates an object of the game from a changed record. Its stats are replaced, and it is moved
+ * to its new space only if the record moved it and the object is still where the old record put it
+ * @param game Pointer to structure Game
+ * @param rec Object record
+ * @param was Space where the previous version of the record put the object
+ * @return OK or ERROR if the object is not in the game
+ */
+STATUS world_patch_object(Game *game, const W_Object *rec, Id was);
+
+/**
+ * @brief Updates the player from a changed record. Only its name, attack and defense are replaced,
+ * its location, health and inventory are kept
+ * @param game Pointer to structure Game
+ * @param rec Player record
+ * @return OK or ERROR if it is not the player of the game
+ */
+STATUS world_patch_player(Game *game, const W_Player *rec);
+
+/**
+ * @brief Updates an enemy of the game from a changed record. Its name, attack and defense are replaced,
+ * its location and health only if they are still those the old record gave it
+ * @param game Pointer to structure Game
+ * @param rec Enemy record
+ * @param was Space where the previous version of the record put the enemy
+ * @param had Health the previous version of the record gave the enemy
+ * @return OK or ERROR if the enemy is not in the game
+ */
+STATUS world_patch_enemy(Game *game, const W_Enemy *rec, Id was, int had);
+
+/**
+ * @brief Updates a link of the game from a changed record, attaching it again if its origin or
+ * direction changed
+ * @param game Pointer to structure Game
+ * @param rec Link record
+ * @return OK or ERROR if the link is not in the game
+ */
+STATUS world_patch_link(Game *game, const W_Link *rec);
+
+#endif
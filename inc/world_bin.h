@@ -0,0 +1,195 @@
+/**
+ * @brief It defines the compiled world format
+ *
+ * A compiled world is a binary image of a data file that can be mapped in
+ * memory and applied to a game without parsing any text. It is made of a
+ * header, one array of fixed width records per kind of entity and a block of
+ * NUL terminated strings. Like W_World it only records where the graphic
+ * description of each space is in the data file.
+ * References to spaces are stored already resolved as indices into the
+ * space array. Every section starts at a multiple of 8 bytes.
+ *
+ * The image is written in the byte order of the machine that compiles it;
+ * it is only meant as a cache and is rebuilt whenever it does not match.
+ *
+ * @file world_bin.h
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef WORLD_BIN_H
+#define WORLD_BIN_H
+
+#include <stdint.h>
+#include <sys/stat.h>
+#include "game.h"
+#include "world.h"
+
+#define WB_MAGIC "ANTW"
+#define WB_VERSION 3
+#define WB_NONE -1 /*!< Index of a reference that could not be resolved */
+
+/**
+ * @brief Header of a compiled world
+ */
+typedef struct {
+  char magic[4];         /*!< WB_MAGIC */
+  uint32_t version;      /*!< WB_VERSION */
+  int64_t src_mtime;     /*!< Modification time of the data file, seconds */
+  int64_t src_mtime_ns;  /*!< Modification time of the data file, nanoseconds */
+  int64_t src_size;      /*!< Size of the data file */
+  uint64_t src_hash;     /*!< Hash of the contents of the data file */
+  uint32_t n_spaces;     /*!< Number of space records */
+  uint32_t n_objects;    /*!< Number of object records */
+  uint32_t n_players;    /*!< Number of player records */
+  uint32_t n_enemies;    /*!< Number of enemy records */
+  uint32_t n_links;      /*!< Number of link records */
+  uint32_t off_spaces;   /*!< Offset of the space records */
+  uint32_t off_objects;  /*!< Offset of the object records */
+  uint32_t off_players;  /*!< Offset of the player records */
+  uint32_t off_enemies;  /*!< Offset of the enemy records */
+  uint32_t off_links;    /*!< Offset of the link records */
+  uint32_t off_strings;  /*!< Offset of the strings */
+  uint32_t size_strings; /*!< Size of the strings */
+} WB_Header;
+
+/**
+ * @brief Compiled space record
+ */
+typedef struct {
+  int64_t id;      /*!< Id of the space */
+  int64_t art;     /*!< Position of its graphic description in the data file */
+  uint32_t name;   /*!< Offset of the name in the strings */
+  uint32_t nlines; /*!< Number of lines of the graphic description */
+  int32_t link[4]; /*!< Index of the link to the north, south, east and west, or WB_NONE */
+} WB_Space;
+
+/**
+ * @brief Compiled object record
+ */
+typedef struct {
+  int64_t id;           /*!< Id of the object */
+  int64_t location;     /*!< Id of the space where it is */
+  int32_t space;        /*!< Index of the space where it is, or WB_NONE */
+  uint32_t name;        /*!< Offset of the name in the strings */
+  int32_t type;         /*!< Rarity */
+  int32_t buff_type;    /*!< Type of the buff */
+  float buff_value;     /*!< Value of the buff */
+  int32_t debuff_type;  /*!< Type of the debuff */
+  float debuff_value;   /*!< Value of the debuff */
+  int32_t consumable;   /*!< If it is consumable */
+  int32_t i;            /*!< Row inside the space */
+  int32_t j;            /*!< Column inside the space */
+} WB_Object;
+
+/**
+ * @brief Compiled player record
+ */
+typedef struct {
+  int64_t id;       /*!< Id of the player */
+  int64_t location; /*!< Id of the space where it is */
+  uint32_t name;    /*!< Offset of the name in the strings */
+  int32_t health;   /*!< Health */
+  int32_t capacity; /*!< Capacity of the inventory */
+  float attack;     /*!< Attack */
+  float defense;    /*!< Defense */
+  int32_t i;        /*!< Row inside the space */
+  int32_t j;        /*!< Column inside the space */
+  uint32_t pad;     /*!< Unused */
+} WB_Player;
+
+/**
+ * @brief Compiled enemy record
+ */
+typedef struct {
+  int64_t id;       /*!< Id of the enemy */
+  int64_t location; /*!< Id of the space where it is */
+  uint32_t name;    /*!< Offset of the name in the strings */
+  int32_t health;   /*!< Health */
+  float attack;     /*!< Attack */
+  float defense;    /*!< Defense */
+  int32_t i;        /*!< Row inside the space */
+  int32_t j;        /*!< Column inside the space */
+} WB_Enemy;
+
+/**
+ * @brief Compiled link record
+ */
+typedef struct {
+  int64_t id;          /*!< Id of the link */
+  int64_t origin;      /*!< Id of the space where it starts */
+  int64_t destination; /*!< Id of the space where it ends */
+  int64_t requirement; /*!< Object or enemy needed to open it */
+  uint32_t name;       /*!< Offset of the name in the strings */
+  int32_t dir;         /*!< Direction in its origin */
+  int32_t open;        /*!< Open or closed */
+  uint32_t pad;        /*!< Unused */
+} WB_Link;
+
+/**
+ * @brief A compiled world mapped in memory
+ */
+typedef struct {
+  const char *data;          /*!< Mapped image */
+  size_t size;               /*!< Size of the image */
+  const WB_Header *header;   /*!< Header */
+  const WB_Space *spaces;    /*!< Space records */
+  const WB_Object *objects;  /*!< Object records */
+  const WB_Player *players;  /*!< Player records */
+  const WB_Enemy *enemies;   /*!< Enemy records */
+  const WB_Link *links;      /*!< Link records */
+  const char *strings;       /*!< Strings */
+} WB_World;
+
+/**
+ * @brief Hashes the contents of a data file (64 bit FNV-1a)
+ * @param data Contents of the file
+ * @param size Number of bytes
+ * @return the hash
+ */
+uint64_t world_bin_hash(const char *data, size_t size);
+
+/**
+ * @brief Compiles a world and writes it to a file. The file is replaced atomically
+ * @param w Pointer to the world
+ * @param path Name of the compiled file
+ * @param src Status of the data file the world comes from
+ * @param hash Hash of the contents of the data file
+ * @return OK or ERROR
+ */
+STATUS world_bin_write(const W_World *w, const char *path, const struct stat *src, uint64_t hash);
+
+/**
+ * @brief Maps a compiled world in memory and checks that it is well formed
+ * @param path Name of the compiled file
+ * @return the mapped world or NULL if it is missing, from another version or damaged
+ */
+WB_World *world_bin_open(const char *path);
+
+/**
+ * @brief Unmaps a compiled world
+ * @param wb Pointer to the mapped world
+ * @return OK or ERROR
+ */
+STATUS world_bin_close(WB_World *wb);
+
+/**
+ * @brief Says if a compiled world was made from a given version of its data file
+ * @param wb Pointer to the mapped world
+ * @param src Status of the data file
+ * @param hash Hash of the contents of the data file
+ * @return TRUE if the modification time, size and hash recorded match
+ */
+BOOL world_bin_matches(const WB_World *wb, const struct stat *src, uint64_t hash);
+
+/**
+ * @brief Creates every entity of a compiled world and adds it to the game, placing the objects
+ * and attaching the links through the recorded indices
+ * @param wb Pointer to the mapped world
+ * @param game Pointer to structure Game, already created
+ * @return OK or ERROR
+ */
+STATUS world_bin_apply(const WB_World *wb, Game *game);
+
+#endif
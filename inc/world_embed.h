@@ -0,0 +1,57 @@
+/**
+ * @brief It defines a world built into the program
+ *
+ * worldc -c turns a data file into a C source file that defines world_image:
+ * one const array of records per kind of entity, with the names and the
+ * lines of the graphic descriptions as string literals. When that file is
+ * linked into the game (make juego-embedded) the game is created from the
+ * tables, without opening or parsing any file.
+ *
+ * The entities are created from the records like with the other loaders,
+ * so what changes while playing (the player, where the objects are, the
+ * links opened, the health of the enemies) starts from the tables but is
+ * never written to them. The art is not copied: the spaces use the lines of
+ * the tables in place.
+ *
+ * @file world_embed.h
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef WORLD_EMBED_H
+#define WORLD_EMBED_H
+
+#include "game.h"
+#include "world.h"
+
+/**
+ * @brief The records of a data file as read only tables, in file order
+ */
+typedef struct {
+  const char *source;       /*!< Name of the data file the tables were made from */
+  const W_Space *spaces;    /*!< Space records, with their lines */
+  int n_spaces;             /*!< Number of space records */
+  const W_Object *objects;  /*!< Object records */
+  int n_objects;            /*!< Number of object records */
+  const W_Player *players;  /*!< Player records */
+  int n_players;            /*!< Number of player records */
+  const W_Enemy *enemies;   /*!< Enemy records */
+  int n_enemies;            /*!< Number of enemy records */
+  const W_Link *links;      /*!< Link records */
+  int n_links;              /*!< Number of link records */
+} W_Image;
+
+/**
+ * @brief The world built into the program, defined by the file made by worldc -c
+ */
+extern const W_Image world_image;
+
+/**
+ * @brief Creates the game and adds to it every entity of world_image
+ * @param game Pointer to structure Game
+ * @return OK if it could create the game, else it returns ERROR
+ */
+STATUS game_create_embedded(Game *game);
+
+#endif
@@ -15,6 +15,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "types.h"
+#include "arena.h"
 
 typedef struct _XP XP;
 
@@ -26,6 +27,23 @@ typedef struct _XP XP;
  */
 XP *xp_create();
 
+/**
+ * @brief It creates a new xp taking the memory from an arena
+ * 
+ * @param arena the arena, or NULL to use the heap
+ * @return XP* the new xp
+ */
+XP *xp_create_in(Arena *arena);
+
+/**
+ * @brief It creates a new xp with the same values as another one, taking the memory from an arena
+ * 
+ * @param arena the arena, or NULL to use the heap
+ * @param xp the xp to copy
+ * @return XP* the new xp, or NULL
+ */
+XP *xp_copy_in(Arena *arena, XP *xp);
+
 /**
  * @brief It destroys an xp
  * 
@@ -0,0 +1,227 @@
+/**
+ * @brief Implements the arena module
+ *
+ * Pieces are cut one after the other from the current block. When it has no
+ * room left a new one is made and linked in front of the old ones, and
+ * pieces too big for a block get a block of their own. The first block is
+ * small and every new one doubles the last up to ARENA_BLOCK, so an arena
+ * that only holds a few entities stays small. A piece given back
+ * keeps the pointer to the next free piece of its class in its first bytes.
+ *
+ * @file arena.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+
+#define ARENA_BLOCK (256 * 1024) /* bytes of a block, at most */
+#define ARENA_FIRST_BLOCK 4096   /* bytes of the first block */
+#define ARENA_CLASSES 256        /* pieces up to ARENA_CLASSES * ARENA_ALIGN bytes are reused */
+
+/**
+ * @brief Header of a block, the pieces follow it
+ */
+typedef struct _Block {
+    struct _Block *next; /*Block made before it*/
+    size_t size;         /*Bytes of the block, header included*/
+} Block;
+
+struct _Arena
+{
+    Block *blocks;              /*Blocks, the last made first*/
+    char *top;                  /*Next free byte of the current block*/
+    char *end;                  /*End of the current block*/
+    void *free[ARENA_CLASSES];  /*Pieces given back, by size class*/
+    size_t next;                /*Bytes of the next block*/
+    long size;                  /*Bytes of all the blocks*/
+};
+
+/* The header is rounded up so that the pieces after it are aligned */
+#define ARENA_HEADER ((sizeof(Block) + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN)
+
+/*----------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Gives the size class of a number of bytes, from 0
+ */
+static size_t arena_class(size_t size)
+{
+    return (size == 0) ? 0 : (size - 1) / ARENA_ALIGN;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Makes a block with room for size bytes of pieces and links it to the arena
+ */
+static Block *arena_block(Arena *arena, size_t size)
+{
+    Block *block = NULL;
+
+    if ((block = (Block *)malloc(ARENA_HEADER + size)) == NULL)
+        return NULL;
+
+    block->size = ARENA_HEADER + size;
+    block->next = arena->blocks;
+    arena->blocks = block;
+    arena->size += block->size;
+
+    return block;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+Arena *arena_create()
+{
+    return (Arena *)calloc(1, sizeof(Arena));
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+STATUS arena_destroy(Arena *arena)
+{
+    Block *block = NULL, *next = NULL;
+
+    if (!arena)
+        return ERROR;
+
+    for (block = arena->blocks; block; block = next)
+    {
+        next = block->next;
+        free(block);
+    }
+    free(arena);
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+STATUS arena_clear(Arena *arena)
+{
+    Block *block = NULL, *next = NULL;
+
+    if (!arena)
+        return ERROR;
+
+    /* The last block made is the biggest, it is kept for what is made next */
+    if (arena->blocks)
+    {
+        for (block = arena->blocks->next; block; block = next)
+        {
+            next = block->next;
+            arena->size -= block->size;
+            free(block);
+        }
+        arena->blocks->next = NULL;
+        arena->top = (char *)arena->blocks + ARENA_HEADER;
+        arena->end = (char *)arena->blocks + arena->blocks->size;
+    }
+    memset(arena->free, 0, sizeof(arena->free));
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+void *arena_alloc(Arena *arena, size_t size)
+{
+    Block *block = NULL;
+    size_t class;
+    void *p = NULL;
+
+    if (!arena)
+        return malloc(size);
+
+    class = arena_class(size);
+    size = (class + 1) * ARENA_ALIGN;
+
+    if (class < ARENA_CLASSES && arena->free[class])
+    {
+        p = arena->free[class];
+        arena->free[class] = *(void **)p;
+        return p;
+    }
+
+    /* Big pieces would leave most of a block unused */
+    if (size > ARENA_BLOCK / 4)
+    {
+        if ((block = arena_block(arena, size)) == NULL)
+            return NULL;
+        return (char *)block + ARENA_HEADER;
+    }
+
+    if (!arena->top || (size_t)(arena->end - arena->top) < size)
+    {
+        if (arena->next < ARENA_FIRST_BLOCK)
+            arena->next = ARENA_FIRST_BLOCK;
+        while (arena->next < size)
+            arena->next *= 2;
+
+        /* The current block is abandoned, what is left of it is not worth a list */
+        if ((block = arena_block(arena, arena->next)) == NULL)
+            return NULL;
+        if (arena->next < ARENA_BLOCK)
+            arena->next *= 2;
+        arena->top = (char *)block + ARENA_HEADER;
+        arena->end = (char *)block + block->size;
+    }
+
+    p = arena->top;
+    arena->top += size;
+
+    return p;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+void arena_free(Arena *arena, void *p, size_t size)
+{
+    size_t class;
+
+    if (!arena)
+    {
+        free(p);
+        return;
+    }
+
+    if (!p)
+        return;
+
+    /* Pieces too big for a class stay in their block until the arena is destroyed */
+    if ((class = arena_class(size)) < ARENA_CLASSES)
+    {
+        *(void **)p = arena->free[class];
+        arena->free[class] = p;
+    }
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+void *arena_realloc(Arena *arena, void *p, size_t old_size, size_t size)
+{
+    void *aux = NULL;
+
+    if (!arena)
+        return realloc(p, size);
+
+    /* Sizes of the same class share the piece */
+    if (p && arena_class(old_size) == arena_class(size))
+        return p;
+
+    if ((aux = arena_alloc(arena, size)) == NULL)
+        return NULL;
+
+    if (p)
+    {
+        memcpy(aux, p, (old_size < size) ? old_size : size);
+        arena_free(arena, p, old_size);
+    }
+
+    return aux;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+long arena_get_size(Arena *arena)
+{
+    if (!arena)
+        return -1;
+
+    return arena->size;
+}
@@ -0,0 +1,182 @@
+/** 
+ * @brief It tests the arena module
+ * 
+ * @file arena_test.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+#include <stdint.h>
+#include "arena.h"
+#include "arena_test.h"
+#include "test.h"
+
+#define MAX_TESTS 12
+
+/** 
+ * @brief Main function for ARENA unit tests. 
+ * 
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed 
+ *   2.- A number means a particular test (the one identified by that number) 
+ *       is executed
+ *  
+ */
+int main(int argc, char** argv) {
+
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2) {
+    printf("Running all test for module Arena:\n");
+  } else {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS) {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+
+  if (all || test == 1) test1_arena_create();
+  if (all || test == 2) test1_arena_destroy();
+  if (all || test == 3) test2_arena_destroy();
+  if (all || test == 4) test1_arena_alloc();
+  if (all || test == 5) test2_arena_alloc();
+  if (all || test == 6) test3_arena_alloc();
+  if (all || test == 7) test1_arena_free();
+  if (all || test == 8) test2_arena_free();
+  if (all || test == 9) test1_arena_realloc();
+  if (all || test == 10) test2_arena_realloc();
+  if (all || test == 11) test1_arena_clear();
+  if (all || test == 12) test2_arena_clear();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_arena_create() {
+  Arena *a;
+  a = arena_create();
+  PRINT_TEST_RESULT(a != NULL && arena_get_size(a) == 0);
+  arena_destroy(a);
+}
+
+void test1_arena_destroy() {
+  Arena *a;
+  a = arena_create();
+  arena_alloc(a, 100);
+  PRINT_TEST_RESULT(arena_destroy(a) == OK);
+}
+
+void test2_arena_destroy() {
+  Arena *a = NULL;
+  PRINT_TEST_RESULT(arena_destroy(a) == ERROR);
+}
+
+void test1_arena_alloc() {
+  Arena *a;
+  char *p, *q;
+  a = arena_create();
+  p = arena_alloc(a, 20);
+  q = arena_alloc(a, 20);
+  memset(p, 1, 20);
+  memset(q, 2, 20);
+  PRINT_TEST_RESULT(p && q && q - p == 32 && (uintptr_t)p % ARENA_ALIGN == 0 && p[19] == 1);
+  arena_destroy(a);
+}
+
+void test2_arena_alloc() {
+  Arena *a;
+  char *p;
+  a = arena_create();
+  p = arena_alloc(a, 1 << 20);
+  memset(p, 0, 1 << 20);
+  PRINT_TEST_RESULT(p != NULL && arena_get_size(a) > (1 << 20));
+  arena_destroy(a);
+}
+
+void test3_arena_alloc() {
+  char *p;
+  p = arena_alloc(NULL, 10);
+  PRINT_TEST_RESULT(p != NULL);
+  arena_free(NULL, p, 10);
+}
+
+void test1_arena_free() {
+  Arena *a;
+  void *p, *q;
+  a = arena_create();
+  p = arena_alloc(a, 40);
+  arena_free(a, p, 40);
+  q = arena_alloc(a, 48);
+  PRINT_TEST_RESULT(p == q);
+  arena_destroy(a);
+}
+
+void test2_arena_free() {
+  Arena *a;
+  void *p, *q;
+  a = arena_create();
+  p = arena_alloc(a, 40);
+  arena_free(a, p, 40);
+  q = arena_alloc(a, 80);
+  PRINT_TEST_RESULT(p != q);
+  arena_destroy(a);
+}
+
+void test1_arena_realloc() {
+  Arena *a;
+  char *p;
+  a = arena_create();
+  p = arena_alloc(a, 8);
+  strcpy(p, "antill");
+  p = arena_realloc(a, p, 8, 100);
+  PRINT_TEST_RESULT(p != NULL && strcmp(p, "antill") == 0);
+  arena_destroy(a);
+}
+
+void test2_arena_realloc() {
+  Arena *a;
+  char *p, *q;
+  a = arena_create();
+  p = arena_alloc(a, 8);
+  q = arena_realloc(a, p, 8, 12);
+  PRINT_TEST_RESULT(p == q);
+  arena_destroy(a);
+}
+
+void test1_arena_clear() {
+  Arena *a;
+  void *p;
+  int i;
+  a = arena_create();
+  for (i = 0; i < 1000; i++)
+    arena_alloc(a, 100);
+  arena_clear(a);
+  p = arena_alloc(a, 100);
+  arena_free(a, arena_alloc(a, 32), 32);
+  arena_clear(a);
+  PRINT_TEST_RESULT(arena_alloc(a, 100) == p && arena_alloc(a, 32) != p);
+  arena_destroy(a);
+}
+
+void test2_arena_clear() {
+  Arena *a;
+  long size;
+  int i;
+  a = arena_create();
+  for (i = 0; i < 1000; i++)
+    arena_alloc(a, 100);
+  size = arena_get_size(a);
+  arena_clear(a);
+  PRINT_TEST_RESULT(arena_get_size(a) > 0 && arena_get_size(a) < size && arena_clear(NULL) == ERROR);
+  arena_destroy(a);
+}
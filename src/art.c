@@ -0,0 +1,303 @@
+/**
+ * @brief Implements the room art store
+ *
+ * The arts in memory are kept in a doubly linked list, most recently used
+ * first, threaded through the entries by index.
+ *
+ * The lines read are interned in a string table of the store, so a line
+ * that many rooms share is kept once, and an art in memory is only its
+ * span of pointers into the table. Dropping an art frees the span; its
+ * lines stay in the table until the store is destroyed, which is what makes
+ * reading the art again cost no memory.
+ *
+ * @file art.c
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "art.h"
+#include "strtab.h"
+
+#define ART_CHUNK 64
+
+/**
+ * @brief An art of the data file
+ */
+typedef struct {
+    long offset;  /*Position of its first line in the file*/
+    int nlines;   /*Number of lines*/
+    const char **lines; /*Its lines in the table of the store, NULL if it is not in memory*/
+    const char *const *fixed; /*Lines that are always in memory and not owned by the store, NULL if they are read*/
+    int prev;     /*More recently used art in memory, -1 if none*/
+    int next;     /*Less recently used art in memory, -1 if none*/
+} Art;
+
+struct _ArtStore
+{
+    char *path;       /*Name of the data file, NULL if every art is fixed*/
+    StrTab *unique;   /*Every different line read*/
+    FILE *file;       /*Data file, opened on the first read*/
+    Art *arts;        /*Every art*/
+    int n_arts;       /*Number of arts*/
+    int max_arts;     /*Allocated size of arts*/
+    int first;        /*Most recently used art in memory*/
+    int last;         /*Least recently used art in memory*/
+    int resident;     /*Number of arts in memory*/
+    int max_resident; /*Maximum number of arts in memory*/
+};
+
+/*----------------------------------------------------------------------------------------------------*/
+static void art_unlink(ArtStore *store, int a)
+{
+    Art *art = &store->arts[a];
+
+    if (art->prev != -1)
+        store->arts[art->prev].next = art->next;
+    else
+        store->first = art->next;
+
+    if (art->next != -1)
+        store->arts[art->next].prev = art->prev;
+    else
+        store->last = art->prev;
+
+    art->prev = art->next = -1;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+static void art_push(ArtStore *store, int a)
+{
+    Art *art = &store->arts[a];
+
+    art->prev = -1;
+    art->next = store->first;
+    if (store->first != -1)
+        store->arts[store->first].prev = a;
+    store->first = a;
+    if (store->last == -1)
+        store->last = a;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+static void art_drop(ArtStore *store, int a)
+{
+    Art *art = &store->arts[a];
+
+    if (!art->lines)
+        return;
+
+    art_unlink(store, a);
+    free(art->lines);
+    art->lines = NULL;
+    store->resident--;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+static STATUS art_read(ArtStore *store, int a)
+{
+    Art *art = &store->arts[a];
+    const char **lines = NULL;
+    char *line = NULL;
+    size_t size = 0;
+    ssize_t len;
+    int i;
+
+    if (!store->path)
+        return ERROR;
+
+    if (!store->file && (store->file = fopen(store->path, "r")) == NULL)
+        return ERROR;
+
+    if (fseek(store->file, art->offset, SEEK_SET) != 0)
+        return ERROR;
+
+    if ((lines = (const char **)calloc(art->nlines + 1, sizeof(char *))) == NULL)
+        return ERROR;
+
+    for (i = 0; i < art->nlines; i++)
+    {
+        if ((len = getline(&line, &size, store->file)) < 0)
+            len = 0;
+        if (len > 0 && line[len - 1] == '\n')
+            len--;
+
+        if ((lines[i] = strtab_intern(store->unique, line ? line : "", len)) == NULL)
+            break;
+    }
+    free(line);
+
+    if (i < art->nlines)
+    {
+        free(lines);
+        return ERROR;
+    }
+
+    art->lines = lines;
+    store->resident++;
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+ArtStore *art_create(const char *path, int max_resident)
+{
+    ArtStore *store;
+
+    if (max_resident < 1)
+        return NULL;
+
+    store = (ArtStore *)calloc(1, sizeof(ArtStore));
+    if (!store)
+        return NULL;
+
+    if ((path && (store->path = strdup(path)) == NULL) || (store->unique = strtab_create()) == NULL)
+    {
+        free(store->path);
+        free(store);
+        return NULL;
+    }
+    store->first = store->last = -1;
+    store->max_resident = max_resident;
+
+    return store;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+STATUS art_destroy(ArtStore *store)
+{
+    int i;
+
+    if (!store)
+        return ERROR;
+
+    for (i = 0; i < store->n_arts; i++)
+        free(store->arts[i].lines);
+    strtab_destroy(store->unique);
+    if (store->file)
+        fclose(store->file);
+    free(store->arts);
+    free(store->path);
+    free(store);
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+static int art_new(ArtStore *store, long offset, int nlines, const char *const *fixed)
+{
+    Art *aux;
+
+    if (store->n_arts == store->max_arts)
+    {
+        aux = (Art *)realloc(store->arts, (store->max_arts + ART_CHUNK + store->max_arts / 2) * sizeof(Art));
+        if (!aux)
+            return -1;
+        store->arts = aux;
+        store->max_arts += ART_CHUNK + store->max_arts / 2;
+    }
+
+    aux = &store->arts[store->n_arts];
+    aux->offset = offset;
+    aux->nlines = nlines;
+    aux->lines = NULL;
+    aux->fixed = fixed;
+    aux->prev = aux->next = -1;
+
+    return store->n_arts++;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+int art_add(ArtStore *store, long offset, int nlines)
+{
+    if (!store || offset < 0 || nlines < 0)
+        return -1;
+
+    return art_new(store, offset, nlines, NULL);
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+int art_add_fixed(ArtStore *store, const char *const *lines, int nlines)
+{
+    if (!store || (!lines && nlines > 0) || nlines < 0)
+        return -1;
+
+    return art_new(store, -1, nlines, lines);
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+STATUS art_set(ArtStore *store, int art, long offset, int nlines)
+{
+    if (!store || art < 0 || art >= store->n_arts || offset < 0 || nlines < 0)
+        return ERROR;
+
+    art_drop(store, art);
+    store->arts[art].offset = offset;
+    store->arts[art].nlines = nlines;
+    store->arts[art].fixed = NULL;
+
+    /* The file may have been replaced, open it again on the next read */
+    if (store->file)
+    {
+        fclose(store->file);
+        store->file = NULL;
+    }
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+const char *art_get_line(ArtStore *store, int art, int i)
+{
+    if (!store || art < 0 || art >= store->n_arts || i < 0 || i >= store->arts[art].nlines)
+        return NULL;
+
+    if (store->arts[art].fixed)
+        return store->arts[art].fixed[i];
+
+    if (!store->arts[art].lines)
+    {
+        if (art_read(store, art) == ERROR)
+            return NULL;
+        art_push(store, art);
+        while (store->resident > store->max_resident)
+            art_drop(store, store->last);
+    }
+    else if (store->first != art)
+    {
+        art_unlink(store, art);
+        art_push(store, art);
+    }
+
+    return store->arts[art].lines[i];
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+int art_get_nlines(ArtStore *store, int art)
+{
+    if (!store || art < 0 || art >= store->n_arts)
+        return -1;
+
+    return store->arts[art].nlines;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+int art_get_resident(ArtStore *store)
+{
+    if (!store)
+        return -1;
+
+    return store->resident;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+int art_get_unique(ArtStore *store)
+{
+    if (!store)
+        return -1;
+
+    return strtab_get_number(store->unique);
+}
@@ -0,0 +1,208 @@
+/** 
+ * @brief It tests the art store module
+ * 
+ * @file art_test.c
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+#include "art.h"
+#include "art_test.h"
+#include "test.h"
+
+#define MAX_TESTS 14
+#define ART_FILE "art_test.tmp"
+
+/*The header line takes 13 characters and every room 24, two lines of 12*/
+#define ART_OFFSET(i) (13 + 24 * (i))
+
+/** 
+ * @brief Writes a data file with four rooms of two lines each
+ */
+static void write_art_file() {
+  FILE *f = fopen(ART_FILE, "w");
+  int i;
+  fprintf(f, "#s:1|Room|2|\n");
+  for (i = 0; i < 4; i++) {
+    fprintf(f, "room%d line0\nroom%d line1\n", i, i);
+  }
+  fclose(f);
+}
+
+/** 
+ * @brief Main function for ART unit tests. 
+ * 
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed 
+ *   2.- A number means a particular test (the one identified by that number) 
+ *       is executed
+ *  
+ */
+int main(int argc, char** argv) {
+
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2) {
+    printf("Running all test for module Art:\n");
+  } else {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS) {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  write_art_file();
+
+  if (all || test == 1) test1_art_create();
+  if (all || test == 2) test2_art_create();
+  if (all || test == 3) test1_art_destroy();
+  if (all || test == 4) test1_art_add();
+  if (all || test == 5) test2_art_add();
+  if (all || test == 6) test1_art_get_line();
+  if (all || test == 7) test2_art_get_line();
+  if (all || test == 8) test3_art_get_line();
+  if (all || test == 9) test1_art_get_resident();
+  if (all || test == 10) test2_art_get_resident();
+  if (all || test == 11) test1_art_set();
+  if (all || test == 12) test1_art_add_fixed();
+  if (all || test == 13) test2_art_add_fixed();
+  if (all || test == 14) test1_art_get_unique();
+
+  remove(ART_FILE);
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_art_create() {
+  ArtStore *s;
+  s = art_create(ART_FILE, 2);
+  PRINT_TEST_RESULT(s != NULL);
+  art_destroy(s);
+}
+
+void test2_art_create() {
+  PRINT_TEST_RESULT(art_create(ART_FILE, 0) == NULL);
+}
+
+void test1_art_destroy() {
+  ArtStore *s = NULL;
+  PRINT_TEST_RESULT(art_destroy(s) == ERROR);
+}
+
+void test1_art_add() {
+  ArtStore *s;
+  s = art_create(ART_FILE, 2);
+  art_add(s, ART_OFFSET(0), 2);
+  PRINT_TEST_RESULT(art_add(s, ART_OFFSET(1), 2) == 1 && art_get_nlines(s, 1) == 2);
+  art_destroy(s);
+}
+
+void test2_art_add() {
+  ArtStore *s;
+  s = art_create(ART_FILE, 2);
+  PRINT_TEST_RESULT(art_add(s, -1, 2) == -1);
+  art_destroy(s);
+}
+
+void test1_art_get_line() {
+  ArtStore *s;
+  int a;
+  s = art_create(ART_FILE, 2);
+  a = art_add(s, ART_OFFSET(2), 2);
+  PRINT_TEST_RESULT(strcmp(art_get_line(s, a, 1), "room2 line1") == 0);
+  art_destroy(s);
+}
+
+void test2_art_get_line() {
+  ArtStore *s;
+  int a;
+  s = art_create(ART_FILE, 2);
+  a = art_add(s, ART_OFFSET(2), 2);
+  PRINT_TEST_RESULT(art_get_line(s, a, 2) == NULL);
+  art_destroy(s);
+}
+
+void test3_art_get_line() {
+  ArtStore *s;
+  int i;
+  s = art_create(ART_FILE, 1);
+  for (i = 0; i < 4; i++) {
+    art_add(s, ART_OFFSET(i), 2);
+  }
+  art_get_line(s, 3, 0);
+  art_get_line(s, 0, 0);
+  PRINT_TEST_RESULT(strcmp(art_get_line(s, 3, 0), "room3 line0") == 0);
+  art_destroy(s);
+}
+
+void test1_art_get_resident() {
+  ArtStore *s;
+  int i;
+  s = art_create(ART_FILE, 2);
+  for (i = 0; i < 4; i++) {
+    art_add(s, ART_OFFSET(i), 2);
+  }
+  PRINT_TEST_RESULT(art_get_resident(s) == 0);
+  art_destroy(s);
+}
+
+void test2_art_get_resident() {
+  ArtStore *s;
+  int i;
+  s = art_create(ART_FILE, 2);
+  for (i = 0; i < 4; i++) {
+    art_add(s, ART_OFFSET(i), 2);
+    art_get_line(s, i, 0);
+  }
+  PRINT_TEST_RESULT(art_get_resident(s) == 2);
+  art_destroy(s);
+}
+
+void test1_art_set() {
+  ArtStore *s;
+  int a;
+  s = art_create(ART_FILE, 2);
+  a = art_add(s, ART_OFFSET(0), 2);
+  art_get_line(s, a, 0);
+  art_set(s, a, ART_OFFSET(1), 1);
+  PRINT_TEST_RESULT(strcmp(art_get_line(s, a, 0), "room1 line0") == 0 && art_get_nlines(s, a) == 1);
+  art_destroy(s);
+}
+
+void test1_art_add_fixed() {
+  static const char *const lines[] = {"fixed line0", "fixed line1"};
+  ArtStore *s;
+  int a;
+  s = art_create(NULL, 1);
+  a = art_add_fixed(s, lines, 2);
+  PRINT_TEST_RESULT(art_get_line(s, a, 1) == lines[1] && art_get_resident(s) == 0);
+  art_destroy(s);
+}
+
+void test2_art_add_fixed() {
+  ArtStore *s;
+  s = art_create(NULL, 1);
+  PRINT_TEST_RESULT(art_add_fixed(s, NULL, 2) == -1 && art_add(s, 0, 1) == 0 && art_get_line(s, 0, 0) == NULL);
+  art_destroy(s);
+}
+
+void test1_art_get_unique() {
+  ArtStore *s;
+  int a, b;
+  s = art_create(ART_FILE, 1);
+  a = art_add(s, ART_OFFSET(1), 2);
+  b = art_add(s, ART_OFFSET(1), 2);
+  PRINT_TEST_RESULT(art_get_line(s, a, 0) == art_get_line(s, b, 0) && art_get_unique(s) == 2 &&
+                    art_get_resident(s) == 1);
+  art_destroy(s);
+}
@@ -15,29 +15,52 @@
 struct _BD{
     BDTYPE type;
     float value;  
+    Arena *arena;
 };
 
 BD *bd_create()
+{
+    return bd_create_in(NULL);
+}
+
+BD *bd_create_in(Arena *arena)
 {
     BD *newBD = NULL;
 
-    newBD = (BD *)malloc(sizeof(BD));
+    newBD = (BD *)arena_alloc(arena, sizeof(BD));
     if (newBD == NULL)
         return NULL;
     
 
     newBD->type = Unkown;
     newBD->value = 0;
+    newBD->arena = arena;
     
     return newBD;
 }
 
+BD *bd_copy_in(Arena *arena, BD *bd)
+{
+    BD *copy = NULL;
+
+    if (!bd)
+        return NULL;
+
+    if ((copy = (BD *)arena_alloc(arena, sizeof(BD))) == NULL)
+        return NULL;
+
+    *copy = *bd;
+    copy->arena = arena;
+
+    return copy;
+}
+
 STATUS bd_destroy(BD *bd)
 {
     if (!bd)
         return ERROR;
 
-    free(bd);
+    arena_free(bd->arena, bd, sizeof(BD));
     bd = NULL;
     return OK;
 }
@@ -8,30 +8,183 @@
 
 #include "enemy.h"
 
+#define ENEMY_CHUNK 64 /* rows a table grows by, besides half of its size */
+
+struct _EnemyTable
+{
+    Id *id;                     /*Enemies' ids*/
+    Id *location;               /*Where the enemies are*/
+    int *health;                /*Health of the enemies*/
+    float *attack;              /*Enemies' attack*/
+    float *defense;             /*Enemies' defense*/
+    unsigned short *position;   /*Enemies' position, bit 3 * i + j set if it is in the cell i, j*/
+    StrId *name;                /*Enemies' names, in the table of the program*/
+    int n;                      /*Number of rows*/
+    int max;                    /*Allocated rows*/
+    Arena *arena;               /*Arena the handles come from, NULL if they are in the heap*/
+};
+
 struct _Enemy
 {
-    Id id;                      /*Structure enemy's id*/
-    char name[WORD_SIZE + 1];   /*Enemy's name*/
-    Id location;                /*Where the enemy is*/
-    int health;                 /*Health of te enemy*/
-    BOOL position[3][3];        /*Enemy's position*/
-    float attack;               /*Enemy's attack*/
-    float defense;              /*Enemy's defense*/
+    EnemyTable *table;          /*Table where the enemy's data is*/
+    int row;                    /*Row of the enemy in the table*/
+    BOOL own;                   /*If the table was made for this enemy alone*/
 };
 
 /*----------------------------------------------------------------------------------------------------*/
-Enemy *enemy_create()
+/**
+ * @brief Makes room in every column of a table for one more row
+ */
+static STATUS enemy_table_grow(EnemyTable *t)
+{
+    int max;
+    void *aux;
+
+    if (t->n < t->max)
+        return OK;
+
+    /* A column that grew before one failed keeps its new size, only max says what is usable */
+    max = t->max + ENEMY_CHUNK + t->max / 2;
+    if ((aux = realloc(t->id, max * sizeof(Id))) == NULL)
+        return ERROR;
+    t->id = aux;
+    if ((aux = realloc(t->location, max * sizeof(Id))) == NULL)
+        return ERROR;
+    t->location = aux;
+    if ((aux = realloc(t->health, max * sizeof(int))) == NULL)
+        return ERROR;
+    t->health = aux;
+    if ((aux = realloc(t->attack, max * sizeof(float))) == NULL)
+        return ERROR;
+    t->attack = aux;
+    if ((aux = realloc(t->defense, max * sizeof(float))) == NULL)
+        return ERROR;
+    t->defense = aux;
+    if ((aux = realloc(t->position, max * sizeof(unsigned short))) == NULL)
+        return ERROR;
+    t->position = aux;
+    if ((aux = realloc(t->name, max * sizeof(StrId))) == NULL)
+        return ERROR;
+    t->name = aux;
+    t->max = max;
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+EnemyTable *enemy_table_create()
+{
+    return enemy_table_create_in(NULL);
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+EnemyTable *enemy_table_create_in(Arena *arena)
+{
+    EnemyTable *t = NULL;
+
+    if ((t = (EnemyTable *)calloc(1, sizeof(EnemyTable))) == NULL)
+        return NULL;
+    t->arena = arena;
+
+    return t;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+STATUS enemy_table_destroy(EnemyTable *t)
+{
+    if (!t)
+        return ERROR;
+
+    free(t->id);
+    free(t->location);
+    free(t->health);
+    free(t->attack);
+    free(t->defense);
+    free(t->position);
+    free(t->name);
+    free(t);
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+STATUS enemy_table_clear(EnemyTable *t)
+{
+    if (!t)
+        return ERROR;
+
+    /* The columns keep their size for the rows that come next */
+    t->n = 0;
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+Enemy *enemy_create_in(EnemyTable *t)
 {
     Enemy *aux = NULL;
+    int row;
+
+    if (!t || enemy_table_grow(t) == ERROR)
+        return NULL;
 
-    aux = (Enemy *)malloc(sizeof(Enemy));
+    aux = (Enemy *)arena_alloc(t->arena, sizeof(Enemy));
     if (!aux)
         return NULL;
 
-    /*initialization of Enemy Struct*/
-    aux->id = 0;
-    aux->name[0] = 0;
-    aux->health = 5;
+    row = t->n;
+
+    /*initialization of the Enemy's row*/
+    t->id[row] = 0;
+    t->name[row] = NO_STR;
+    t->location[row] = NO_ID;
+    t->health[row] = 5;
+    t->attack[row] = 0;
+    t->defense[row] = 0;
+    t->position[row] = 0;
+    t->n++;
+
+    aux->table = t;
+    aux->row = row;
+    aux->own = FALSE;
+
+    return aux;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+Enemy *enemy_copy_in(EnemyTable *t, Enemy *e)
+{
+    Enemy *aux = NULL;
+
+    if (!e || (aux = enemy_create_in(t)) == NULL)
+        return NULL;
+
+    t->id[aux->row] = e->table->id[e->row];
+    t->name[aux->row] = e->table->name[e->row];
+    t->location[aux->row] = e->table->location[e->row];
+    t->health[aux->row] = e->table->health[e->row];
+    t->attack[aux->row] = e->table->attack[e->row];
+    t->defense[aux->row] = e->table->defense[e->row];
+    t->position[aux->row] = e->table->position[e->row];
+
+    return aux;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+Enemy *enemy_create()
+{
+    EnemyTable *t = NULL;
+    Enemy *aux = NULL;
+
+    if ((t = enemy_table_create()) == NULL)
+        return NULL;
+
+    if ((aux = enemy_create_in(t)) == NULL)
+    {
+        enemy_table_destroy(t);
+        return NULL;
+    }
+    aux->own = TRUE;
 
     return aux;
 }
@@ -42,7 +195,7 @@ Id enemy_getId(Enemy *e)
     if (!e)
         return NO_ID;
 
-    return e->id;
+    return e->table->id[e->row];
 }
 
 /*----------------------------------------------------------------------------------------------------*/
@@ -51,7 +204,7 @@ STATUS enemy_setId(Enemy *e, Id id)
     if (!e || id < 0)
         return ERROR;
 
-    e->id = id;
+    e->table->id[e->row] = id;
     return OK;
 }
 
@@ -61,16 +214,30 @@ char *enemy_getName(Enemy *e)
     if (!e)
         return NULL;
 
-    return e->name;
+    return (char *)strtab_str(e->table->name[e->row]);
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+StrId enemy_getNameId(Enemy *e)
+{
+    if (!e)
+        return NO_STR;
+
+    return e->table->name[e->row];
 }
 
 /*----------------------------------------------------------------------------------------------------*/
 STATUS enemy_setName(Enemy *e, char *name)
 {
+    StrId id;
+
     if (!e || !name)
         return ERROR;
 
-    strcpy(e->name, name);
+    if ((id = strtab_id(name)) == NO_STR && name[0])
+        return ERROR;
+
+    e->table->name[e->row] = id;
     return OK;
 }
 
@@ -80,7 +247,7 @@ Id enemy_getLocation(Enemy *e)
     if (!e)
         return NO_ID;
 
-    return e->location;
+    return e->table->location[e->row];
 }
 
 /*----------------------------------------------------------------------------------------------------*/
@@ -89,7 +256,7 @@ STATUS enemy_setLocation(Enemy *e, Id id)
     if (!e)
         return ERROR;
 
-    e->location = id;
+    e->table->location[e->row] = id;
     return OK;
 }
 
@@ -99,7 +266,7 @@ int enemy_getHealth(Enemy *e)
     if (!e)
         return -1;
 
-    return e->health;
+    return e->table->health[e->row];
 }
 
 /*----------------------------------------------------------------------------------------------------*/
@@ -108,7 +275,7 @@ STATUS enemy_setHealth(Enemy *e, int h)
     if (!e)
         return ERROR;
 
-    e->health = h;
+    e->table->health[e->row] = h;
     return OK;
 }
 /*----------------------------------------------------------------------------------------------------*/
@@ -117,7 +284,14 @@ STATUS enemy_destroy(Enemy *e)
     if (!e)
         return ERROR;
 
-    free(e);
+    /* The row of an enemy in a shared table goes away with the table */
+    if (e->own)
+    {
+        enemy_table_destroy(e->table);
+        free(e);
+    }
+    else
+        arena_free(e->table->arena, e, sizeof(Enemy));
     e = NULL;
     return OK;
 }
@@ -141,32 +315,24 @@ STATUS enemy_setPosition(Enemy *p, int x, int y) {
     if(!p || x<0 || x>2 || y<0 || y>2)
         return ERROR;
 
-    if(enemy_resetPosition(p) == ERROR) 
-        return ERROR;
-    
-    p->position[x][y] = TRUE;
+    p->table->position[p->row] = 1 << (3 * x + y);
     return OK;
 }
 
 /*----------------------------------------------------------------------------------------------------*/
 BOOL enemy_isHere(Enemy *p, int i, int j) {
-    if(!p)
+    if(!p || i<0 || i>2 || j<0 || j>2)
         return FALSE;
-    
-    return p->position[i][j];
+
+    return (p->table->position[p->row] >> (3 * i + j)) & 1 ? TRUE : FALSE;
 }
 
 /*----------------------------------------------------------------------------------------------------*/
 STATUS enemy_resetPosition(Enemy *p) {
-    int i, j;
     if(!p)
         return ERROR;
-    
-    for(i=0; i<3; i++) {
-        for(j=0; j<3; j++) {
-            p->position[i][j] = FALSE;
-        }
-    }
+
+    p->table->position[p->row] = 0;
     return OK;
 }
 
@@ -174,16 +340,16 @@ STATUS enemy_resetPosition(Enemy *p) {
 float enemy_getAttack(Enemy *e) {
     if(!e)
         return -1;
-    
-    return e->attack;
+
+    return e->table->attack[e->row];
 }
 
 /*----------------------------------------------------------------------------------------------------*/
 STATUS enemy_setAttack(Enemy *e, float a) {
     if(!e || a<0)
         return ERROR;
-    
-    e->attack = a;
+
+    e->table->attack[e->row] = a;
     return OK;
 }
 
@@ -191,15 +357,83 @@ STATUS enemy_setAttack(Enemy *e, float a) {
 float enemy_getDefense(Enemy *e) {
     if(!e)
         return -1;
-    
-    return e->defense;
+
+    return e->table->defense[e->row];
 }
 
 /*----------------------------------------------------------------------------------------------------*/
 STATUS enemy_setDefense(Enemy *e, float d) {
     if(!e || d<0)
         return ERROR;
-    
-    e->defense = d;
+
+    e->table->defense[e->row] = d;
     return OK;
-}
\ No newline at end of file
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+int enemy_table_get_number(EnemyTable *t)
+{
+    if (!t)
+        return -1;
+
+    return t->n;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+Id *enemy_table_get_locations(EnemyTable *t)
+{
+    if (!t)
+        return NULL;
+
+    return t->location;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+int *enemy_table_get_health(EnemyTable *t)
+{
+    if (!t)
+        return NULL;
+
+    return t->health;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+float *enemy_table_get_attack(EnemyTable *t)
+{
+    if (!t)
+        return NULL;
+
+    return t->attack;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+float *enemy_table_get_defense(EnemyTable *t)
+{
+    if (!t)
+        return NULL;
+
+    return t->defense;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+int enemy_table_heal(EnemyTable *t, int amount, int max)
+{
+    int i, healed = 0, h;
+
+    if (!t)
+        return -1;
+
+    /* Only the location and health columns are read, one after the other */
+    for (i = 0; i < t->n; i++)
+    {
+        h = t->health[i] + amount;
+        h = (h > max) ? max : h;
+        if (t->location[i] != DEAD && h > t->health[i])
+        {
+            t->health[i] = h;
+            healed++;
+        }
+    }
+
+    return healed;
+}
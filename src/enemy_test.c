@@ -5,7 +5,7 @@
 #include "test.h"
 #include "enemy_test.h"
 
-#define MAX_TESTS 20
+#define MAX_TESTS 24
 
 int main (int argc, char *argv[])
 {
@@ -46,6 +46,11 @@ int main (int argc, char *argv[])
     if (all || test == 17) test2_enemy_setLocation();
     if (all || test == 18) test1_enemy_getLocation();
     if (all || test == 19) test2_enemy_getLocation();
+    if (all || test == 20) test1_enemy_create_in();
+    if (all || test == 21) test2_enemy_create_in();
+    if (all || test == 22) test1_enemy_table_heal();
+    if (all || test == 23) test1_enemy_copy_in();
+    if (all || test == 24) test1_enemy_table_clear();
 
     
     PRINT_PASSED_PERCENTAGE; 
@@ -175,3 +180,74 @@ void test2_enemy_getLocation() {
     enemy = NULL;
     PRINT_TEST_RESULT (enemy_getLocation(enemy) == NO_ID);
 }
+
+void test1_enemy_create_in() {
+    EnemyTable *table;
+    Enemy *a, *b;
+    table = enemy_table_create();
+    a = enemy_create_in(table);
+    b = enemy_create_in(table);
+    enemy_setHealth(a, 3);
+    enemy_setLocation(b, 11);
+    PRINT_TEST_RESULT (enemy_table_get_number(table) == 2 && enemy_table_get_health(table)[0] == 3 &&
+                       enemy_table_get_locations(table)[1] == 11 && enemy_getHealth(b) == 5);
+    enemy_destroy(a);
+    enemy_destroy(b);
+    enemy_table_destroy(table);
+}
+
+void test2_enemy_create_in() {
+    PRINT_TEST_RESULT (enemy_create_in(NULL) == NULL && enemy_table_get_number(NULL) == -1);
+}
+
+void test1_enemy_table_heal() {
+    EnemyTable *table;
+    Enemy *a, *b, *c;
+    table = enemy_table_create();
+    a = enemy_create_in(table);
+    b = enemy_create_in(table);
+    c = enemy_create_in(table);
+    enemy_setHealth(a, 1);
+    enemy_setHealth(b, 1);
+    enemy_setLocation(b, DEAD);
+    enemy_setHealth(c, 4);
+    PRINT_TEST_RESULT (enemy_table_heal(table, 2, 5) == 2 && enemy_getHealth(a) == 3 && enemy_getHealth(b) == 1 &&
+                       enemy_getHealth(c) == 5);
+    enemy_destroy(a);
+    enemy_destroy(b);
+    enemy_destroy(c);
+    enemy_table_destroy(table);
+}
+
+void test1_enemy_copy_in() {
+    EnemyTable *table, *other;
+    Enemy *a, *b;
+    table = enemy_table_create();
+    other = enemy_table_create();
+    a = enemy_create_in(table);
+    enemy_setId(a, 41);
+    enemy_setName(a, "BOSS");
+    enemy_setHealth(a, 50);
+    b = enemy_copy_in(other, a);
+    enemy_setHealth(b, 0);
+    PRINT_TEST_RESULT (enemy_getId(b) == 41 && strcmp(enemy_getName(b), "BOSS") == 0 && enemy_getHealth(a) == 50 &&
+                       enemy_table_get_health(other)[0] == 0);
+    enemy_destroy(a);
+    enemy_destroy(b);
+    enemy_table_destroy(table);
+    enemy_table_destroy(other);
+}
+
+void test1_enemy_table_clear() {
+    EnemyTable *table;
+    Enemy *a;
+    table = enemy_table_create();
+    a = enemy_create_in(table);
+    enemy_setName(a, "ant");
+    enemy_destroy(a);
+    enemy_table_clear(table);
+    a = enemy_create_in(table);
+    PRINT_TEST_RESULT (enemy_table_get_number(table) == 1 && enemy_getHealth(a) == 5 && enemy_table_clear(NULL) == ERROR);
+    enemy_destroy(a);
+    enemy_table_destroy(table);
+}
@@ -14,6 +14,11 @@
 #include <string.h>
 #include <time.h>
 #include "game.h"
+#include "levels.h"
+#include "loader.h"
+#include "shared.h"
+
+#define GAME_CHUNK 64 /*Initial size of the entity tables*/
 
 /**
    Private functions
@@ -29,36 +34,129 @@ void game_command_combat(Game *game);
 void game_command_use(Game *game);
 void game_command_admin(Game *game);
 
+/**
+ * @brief Gets the enemy in the space of the player. The space may still be the one of a shared world,
+ * so the enemy is looked for in the game by its id
+ */
 Enemy *_game_get_enemy_fromPlayer_location(Game *game) {
-  int i = 0;
-  BOOL found = FALSE;
-  Enemy *enemy = NULL;
+  return game_get_enemy(game, enemy_getId(space_get_enemy(game_get_space(game, player_getLocation(game->play)))));
+}
 
-  while ((game->enemy[i] < MAX_ENEMY) && !found) {
-    if (enemy_getLocation(game->enemy[i]) == player_getLocation(game->play)) {
-      found = TRUE;
-      enemy = game->enemy[i];
-    }
-    i++;
-  }
-  return enemy;
+/**
+ * @brief Gets a space of the game that can be changed. If the game still shares it with its world, it
+ * is copied first, with the enemies of the game in it
+ */
+static Space *game_own_space(Game *game, Id id)
+{
+  Space *space = NULL;
+  int i;
+
+  if (id == NO_ID || (i = idmap_get(game->space_ids, id)) < 0)
+    return NULL;
+
+  if (!game->shared || game->spaces[i] != shared_get_game(game->shared)->spaces[i])
+    return game->spaces[i];
+
+  if ((space = shared_copy_space(game, game->spaces[i])) == NULL)
+    return NULL;
+
+  game->spaces[i] = space;
+
+  return space;
+}
+
+/**
+ * @brief Gets a link of the game that can be changed, copying it first if it is shared with the world
+ */
+static Link *game_own_link(Game *game, Id id)
+{
+  Link *link = NULL;
+  Space *origin = NULL;
+  int i;
+
+  if (id == NO_ID || (i = idmap_get(game->link_ids, id)) < 0)
+    return NULL;
+
+  if (!game->shared || game->links[i] != shared_get_game(game->shared)->links[i])
+    return game->links[i];
+
+  /* The exit of its space must lead to the copy, so the space is made the game's own too */
+  if ((origin = game_own_space(game, link_getOrigin(game->links[i]))) == NULL)
+    return NULL;
+
+  if ((link = link_copy_in(game->arena, game->links[i])) == NULL)
+    return NULL;
+
+  game->links[i] = link;
+  space_set_link(origin, link_getDirection(link), link, space_get_neighbour(origin, link_getDirection(link)));
+
+  return link;
 }
 
+/**
+ * @brief Gets an object of the game that can be changed, copying it first if it is shared with the world
+ */
+static Object *game_own_object(Game *game, Id id)
+{
+  Object *object = NULL;
+  int i;
+
+  if (id == NO_ID || (i = idmap_get(game->object_ids, id)) < 0)
+    return NULL;
+
+  if (!game->shared || game->objects[i] != shared_get_game(game->shared)->objects[i])
+    return game->objects[i];
+
+  if ((object = object_copy_in(game->arena, game->objects[i])) == NULL)
+    return NULL;
+
+  game->objects[i] = object;
+
+  return object;
+}
+
+/**
+ * @brief Finds an object by its name or the start of it, without caring about case. The index of the
+ * names is made the first time it is needed
+ */
 Id _game_getObjectId_fromName(Game *game, char *name) {
   int i = 0;
-  BOOL found = FALSE;
-  Id id = NO_ID;
-
-  while (i < MAX_OBJECTS && !found) {
-    if (object_get_name(game->objects[i]) != NULL) {
-      if (strcmp(object_get_name(game->objects[i]), name) == 0) {
-        found = TRUE;
-        id = object_get_id(game->objects[i]);
+
+  if (!game->object_names) {
+    if ((game->object_names = names_create()) == NULL)
+      return NO_ID;
+    for (i = 0; i < game->n_objects; i++) {
+      if (names_add(game->object_names, object_get_name(game->objects[i]), object_get_id(game->objects[i])) == ERROR) {
+        names_destroy(game->object_names);
+        game->object_names = NULL;
+        return NO_ID;
       }
     }
-    i++;
   }
-  return id;
+
+  return names_find(game->object_names, name);
+}
+
+/**
+ * @brief Makes room in an entity table for one more entity and the NULL that ends it
+ * @param table The table, NULL if it was never allocated
+ * @param n Number of entities in it
+ * @param max Allocated size, updated when it grows
+ * @return the table, which may have moved, or NULL if there is no memory
+ */
+static void *game_grow(void *table, int n, int *max)
+{
+  void *aux = NULL;
+
+  if (table && n + 1 < *max)
+    return table;
+
+  aux = realloc(table, (*max + GAME_CHUNK + *max / 2) * sizeof(void *));
+  if (!aux)
+    return NULL;
+  *max += GAME_CHUNK + *max / 2;
+
+  return aux;
 }
 
 /**
@@ -72,27 +170,46 @@ Id _game_getObjectId_fromName(Game *game, char *name) {
  */
 STATUS game_create(Game *game)
 {
-  int i;
-
-  for (i = 0; i < MAX_SPACES; i++)
-  {
-    game->spaces[i] = NULL;
-  }
-
-  for (i = 0; i < MAX_OBJECTS; i++)
-  {
-    game->objects[i] = NULL;
-  }
-  for (i = 0; i < MAX_LINKS; i++)
-  {
-    game->links[i] = NULL;
-  }
-  for (i = 0; i < MAX_ENEMY; i++)
+  game->n_spaces = game->n_objects = game->n_links = game->n_enemies = 0;
+  game->max_spaces = game->max_objects = game->max_links = game->max_enemies = 0;
+  game->spaces = game_grow(NULL, 0, &game->max_spaces);
+  game->objects = game_grow(NULL, 0, &game->max_objects);
+  game->links = game_grow(NULL, 0, &game->max_links);
+  game->enemy = game_grow(NULL, 0, &game->max_enemies);
+  game->object_locations = (Id *)malloc(game->max_objects * sizeof(Id));
+  game->arena = arena_create();
+  game->enemy_table = enemy_table_create_in(game->arena);
+  game->space_ids = idmap_create();
+  game->object_ids = idmap_create();
+  game->link_ids = idmap_create();
+  game->enemy_ids = idmap_create();
+  if (!game->spaces || !game->objects || !game->links || !game->enemy || !game->object_locations || !game->arena || !game->enemy_table ||
+      !game->space_ids || !game->object_ids || !game->link_ids || !game->enemy_ids)
   {
-    game->enemy[i] = NULL;
+    free(game->spaces);
+    free(game->objects);
+    free(game->links);
+    free(game->enemy);
+    free(game->object_locations);
+    enemy_table_destroy(game->enemy_table);
+    arena_destroy(game->arena);
+    idmap_destroy(game->space_ids);
+    idmap_destroy(game->object_ids);
+    idmap_destroy(game->link_ids);
+    idmap_destroy(game->enemy_ids);
+    return ERROR;
   }
+  game->spaces[0] = NULL;
+  game->objects[0] = NULL;
+  game->links[0] = NULL;
+  game->enemy[0] = NULL;
 
   game->play = NULL;
+  game->art = NULL;
+  game->levels = NULL;
+  game->loader = NULL;
+  game->shared = NULL;
+  game->object_names = NULL;
   game->last_cmd = NO_CMD;
   game->description[0] = '\0';
   game->rounds = 0;
@@ -111,27 +228,43 @@ STATUS game_create(Game *game)
  */
 STATUS game_destroy(Game *game)
 {
-  int i = 0;
-
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
-  {
-    space_destroy(game->spaces[i]);
-  }
-  for (i = 0; i < MAX_OBJECTS && game->objects[i] != NULL; i++)
-  {
-    object_destroy(game->objects[i]);
-  }
-  for (i = 0; i < MAX_LINKS && game->links[i] != NULL; i++)
-  {
-    link_destroy(game->links[i]);
-  }
-  for (i = 0; i < MAX_ENEMY && game->enemy[i] != NULL; i++)
+  loader_destroy(game->loader);
+  game->loader = NULL;
+  levels_destroy(game->levels);
+  game->levels = NULL;
+  /* Every entity was made in the arena, destroying it frees them all */
+  arena_destroy(game->arena);
+  game->arena = NULL;
+  game->play = NULL;
+  free(game->spaces);
+  free(game->objects);
+  free(game->links);
+  free(game->enemy);
+  free(game->object_locations);
+  enemy_table_destroy(game->enemy_table);
+  game->spaces = NULL;
+  game->objects = NULL;
+  game->object_locations = NULL;
+  game->enemy_table = NULL;
+  game->links = NULL;
+  game->enemy = NULL;
+  game->n_spaces = game->n_objects = game->n_links = game->n_enemies = 0;
+  names_destroy(game->object_names);
+  game->object_names = NULL;
+
+  /* The maps of ids and the art of a session are those of its world */
+  if (!game->shared)
   {
-    enemy_destroy(game->enemy[i]);
-  }
-
-
-  player_destroy(game->play);
+    idmap_destroy(game->space_ids);
+    idmap_destroy(game->object_ids);
+    idmap_destroy(game->link_ids);
+    idmap_destroy(game->enemy_ids);
+    art_destroy(game->art);
+  }
+  game->space_ids = game->object_ids = game->link_ids = game->enemy_ids = NULL;
+  game->art = NULL;
+  shared_remove_session(game->shared);
+  game->shared = NULL;
   game = NULL;
 
   return OK;
@@ -147,24 +280,30 @@ STATUS game_destroy(Game *game)
  */
 STATUS game_add_space(Game *game, Space *space)
 {
-  int i = 0;
+  Space **aux = NULL;
 
-  if (space == NULL)
+  /* A session uses the maps of ids of its world, no entity can be added to it or removed */
+  if (space == NULL || game->shared)
   {
     return ERROR;
   }
 
-  while (i < MAX_SPACES && game->spaces[i] != NULL)
+  if ((aux = game_grow(game->spaces, game->n_spaces, &game->max_spaces)) == NULL)
   {
-    i++;
+    return ERROR;
   }
 
-  if (i >= MAX_SPACES)
+  game->spaces = aux;
+
+  /* If the id is already in the game, the space added first keeps being found */
+  if (idmap_get(game->space_ids, space_get_id(space)) < 0 &&
+      idmap_put(game->space_ids, space_get_id(space), game->n_spaces) == ERROR)
   {
     return ERROR;
   }
 
-  game->spaces[i] = space;
+  game->spaces[game->n_spaces++] = space;
+  game->spaces[game->n_spaces] = NULL;
 
   return OK;
 }
@@ -179,20 +318,46 @@ STATUS game_add_space(Game *game, Space *space)
  */
 STATUS game_add_object(Game *game, Object *object)
 {
-  int i = 0;
+  Object **aux = NULL;
+  Id *locations = NULL;
+  int max;
 
-  if (object == NULL)
+  if (object == NULL || game->shared)
   {
     return ERROR;
   }
 
-  while (i < MAX_OBJECTS && game->objects[i] != NULL)
-    i++;
+  max = game->max_objects;
+  if ((aux = game_grow(game->objects, game->n_objects, &game->max_objects)) == NULL)
+    return ERROR;
+
+  game->objects = aux;
 
-  if (i >= MAX_OBJECTS)
+  /* The locations grow with the table, one for every place in it */
+  if (game->max_objects != max)
+  {
+    if ((locations = (Id *)realloc(game->object_locations, game->max_objects * sizeof(Id))) == NULL)
+    {
+      game->max_objects = max;
+      return ERROR;
+    }
+    game->object_locations = locations;
+  }
+
+  if (idmap_get(game->object_ids, object_get_id(object)) < 0 &&
+      idmap_put(game->object_ids, object_get_id(object), game->n_objects) == ERROR)
     return ERROR;
 
-  game->objects[i] = object;
+  game->object_locations[game->n_objects] = NO_ID;
+  game->objects[game->n_objects++] = object;
+  game->objects[game->n_objects] = NULL;
+
+  /* Without memory for the name the index is made again when it is needed */
+  if (game->object_names && names_add(game->object_names, object_get_name(object), object_get_id(object)) == ERROR)
+  {
+    names_destroy(game->object_names);
+    game->object_names = NULL;
+  }
 
   return OK;
 }
@@ -207,24 +372,114 @@ STATUS game_add_object(Game *game, Object *object)
  */
 STATUS game_add_link(Game *game, Link *link)
 {
-  int i = 0;
+  Link **aux = NULL;
 
-  if (link == NULL)
+  if (link == NULL || game->shared)
   {
     return ERROR;
   }
 
-  while (i < MAX_LINKS && game->links[i] != NULL)
+  if ((aux = game_grow(game->links, game->n_links, &game->max_links)) == NULL)
   {
-    i++;
+    return ERROR;
   }
 
-  if (i >= MAX_LINKS)
+  game->links = aux;
+
+  if (idmap_get(game->link_ids, link_getId(link)) < 0 &&
+      idmap_put(game->link_ids, link_getId(link), game->n_links) == ERROR)
   {
     return ERROR;
   }
 
-  game->links[i] = link;
+  game->links[game->n_links++] = link;
+  game->links[game->n_links] = NULL;
+
+  return OK;
+}
+
+/*-----------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Removes a space from the game and destroys it, keeping the rest of the spaces together
+ * @param game Pointer to structure Game
+ * @param id Space's ID
+ * @return OK if it removed the space, else, returns ERROR
+ */
+STATUS game_remove_space(Game *game, Id id)
+{
+  int i = 0, j, k;
+  Id moved = NO_ID, *ids = NULL;
+
+  if (!game || id == NO_ID || game->shared)
+  {
+    return ERROR;
+  }
+
+  if ((i = idmap_get(game->space_ids, id)) < 0)
+  {
+    return ERROR;
+  }
+
+  /* The objects in it leave the game with it */
+  ids = space_get_objects(game->spaces[i]);
+  for (k = 0; ids && k < set_get_numberofIds(space_get_set(game->spaces[i])); k++)
+  {
+    if ((j = idmap_get(game->object_ids, ids[k])) >= 0 && game->object_locations[j] == id)
+    {
+      game->object_locations[j] = NO_ID;
+    }
+  }
+
+  space_destroy(game->spaces[i]);
+  idmap_remove(game->space_ids, id);
+  game->spaces[i] = game->spaces[--game->n_spaces];
+  game->spaces[game->n_spaces] = NULL;
+
+  /* The last space took its place */
+  moved = space_get_id(game->spaces[i]);
+  if (i < game->n_spaces && idmap_get(game->space_ids, moved) == game->n_spaces)
+  {
+    idmap_put(game->space_ids, moved, i);
+  }
+
+  return OK;
+}
+
+/*-----------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Removes a link from the game and destroys it, keeping the rest of the links together
+ * @param game Pointer to structure Game
+ * @param id Link's ID
+ * @return OK if it removed the link, else, returns ERROR
+ */
+STATUS game_remove_link(Game *game, Id id)
+{
+  int i = 0;
+  Id moved = NO_ID;
+
+  if (!game || id == NO_ID || game->shared)
+  {
+    return ERROR;
+  }
+
+  if ((i = idmap_get(game->link_ids, id)) < 0)
+  {
+    return ERROR;
+  }
+
+  link_destroy(game->links[i]);
+  idmap_remove(game->link_ids, id);
+  game->links[i] = game->links[--game->n_links];
+  game->links[game->n_links] = NULL;
+
+  /* The last link took its place */
+  moved = link_getId(game->links[i]);
+  if (i < game->n_links && idmap_get(game->link_ids, moved) == game->n_links)
+  {
+    idmap_put(game->link_ids, moved, i);
+  }
 
   return OK;
 }
@@ -243,6 +498,10 @@ STATUS game_add_player(Game *game, Player *player) {
 
   game->play = player;
 
+  /* The positions of the objects never change, so what it carries can be kept in a bitset over them.
+     If it already carries something the game does not have, it keeps using its set */
+  inventory_setIndex(player_getInventory(player), game->object_ids);
+
   return OK;
 }
 
@@ -255,25 +514,79 @@ STATUS game_add_player(Game *game, Player *player) {
  * @return OK if it created the new enemy, else, returns ERROR
  */
 STATUS game_add_enemy(Game *game, Enemy *enemy) {
-  int i =0;
+  Enemy **aux = NULL;
 
-  if (enemy == NULL)
+  if (enemy == NULL || game->shared)
     return ERROR;
 
-  while (i < MAX_ENEMY && game->enemy[i] != NULL) {
-    i++;
-  }
+  if ((aux = game_grow(game->enemy, game->n_enemies, &game->max_enemies)) == NULL)
+    return ERROR;
+
+  game->enemy = aux;
 
-  if (i >= MAX_ENEMY)
+  if (idmap_get(game->enemy_ids, enemy_getId(enemy)) < 0 &&
+      idmap_put(game->enemy_ids, enemy_getId(enemy), game->n_enemies) == ERROR)
     return ERROR;
-  
-  game->enemy[i] = enemy;
+
+  game->enemy[game->n_enemies++] = enemy;
+  game->enemy[game->n_enemies] = NULL;
+
+  /* If its space is not in the game yet, world_fixup puts it there once the spaces are added */
+  space_add_enemy(game_get_space(game, enemy_getLocation(enemy)), enemy);
+
+  return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Moves an enemy, to another space or to DEAD, keeping the enemies of the spaces in step
+ * @param game Pointer to structure Game
+ * @param enemy Pointer to structure Enemy, already in the game
+ * @param location Id of the space, DEAD or NO_ID
+ * @return OK if it moved the enemy, else, returns ERROR
+ */
+STATUS game_set_enemy_location(Game *game, Enemy *enemy, Id location) {
+  if (!game || !enemy)
+    return ERROR;
+
+  if (enemy_getLocation(enemy) == location)
+    return OK;
+
+  space_delete_enemy(game_own_space(game, enemy_getLocation(enemy)), enemy);
+  enemy_setLocation(enemy, location);
+  space_add_enemy(game_own_space(game, location), enemy);
 
   return OK;
 }
 
 /*----------------------------------------------------------------------------------------------------------*/
 
+/**
+ * @brief Opens or closes a link
+ * @param game Pointer to structure Game
+ * @param id Link's ID
+ * @param open TRUE to open it, FALSE to close it
+ * @return OK if it changed the link, else, returns ERROR
+ */
+STATUS game_set_link_open(Game *game, Id id, BOOL open) {
+  Link *link = NULL;
+
+  if (!game || (link = game_get_link(game, id)) == NULL)
+    return ERROR;
+
+  /* A link shared with the world is only copied if it really changes */
+  if (link_getOpen(link) == open)
+    return OK;
+
+  if ((link = game_own_link(game, id)) == NULL)
+    return ERROR;
+
+  return link_setOpen(link, open);
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+
 /**
  * @brief It gets the position's id
  * @param game Pointer to structure Game
@@ -282,7 +595,7 @@ STATUS game_add_enemy(Game *game, Enemy *enemy) {
  */
 Id game_get_space_id_at(Game *game, int position)
 {
-  if (position < 0 || position >= MAX_SPACES)
+  if (position < 0 || position >= game->n_spaces)
     return NO_ID;
 
   return space_get_id(game->spaces[position]);
@@ -305,15 +618,12 @@ Space *game_get_space(Game *game, Id id)
     return NULL;
   }
 
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
+  if ((i = idmap_get(game->space_ids, id)) < 0)
   {
-    if (id == space_get_id(game->spaces[i]))
-    {
-      return game->spaces[i];
-    }
+    return NULL;
   }
 
-  return NULL;
+  return game->spaces[i];
 }
 
 /*----------------------------------------------------------------------------------------------------------*/
@@ -330,12 +640,85 @@ Link *game_get_link(Game *game, Id id) {
   if (id == NO_ID)
     return NULL;
 
-  for (i = 0; i < MAX_LINKS && game->links[i] != NULL; i++) {
-    if (id == link_getId(game->links[i]))
-      return game->links[i];
+  if ((i = idmap_get(game->link_ids, id)) < 0)
+    return NULL;
+
+  return game->links[i];
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Changes the name of an object of the game
+ * @param game Pointer to structure Game
+ * @param object Pointer to structure Object
+ * @param name new name
+ * @return OK or ERROR
+*/
+STATUS game_set_object_name(Game *game, Object *object, char *name)
+{
+  if (!game || !object || !name)
+    return ERROR;
+
+  if ((object = game_own_object(game, object_get_id(object))) == NULL || object_set_name(object, name) == ERROR)
+    return ERROR;
+
+  /* The old name cannot be taken out of the index, it is made again when it is needed */
+  names_destroy(game->object_names);
+  game->object_names = NULL;
+
+  return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Adds to the game the rest of the world that was being loaded in the background
+ * @param game Pointer to structure Game
+ * @param wait TRUE to wait until it is loaded
+ * @return OK or ERROR
+*/
+STATUS game_finish_load(Game *game, BOOL wait)
+{
+  STATUS status;
+
+  if (!game)
+    return ERROR;
+
+  if (!game->loader || (!wait && !loader_is_done(game->loader)))
+    return OK;
+
+  status = loader_finish(game->loader, game);
+  loader_destroy(game->loader);
+  game->loader = NULL;
+
+  return status;
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief It resolves the exits of every space into pointers to their links and destinations
+ * @param game Pointer to structure Game
+ * @return OK or ERROR
+*/
+STATUS game_resolve_links(Game *game) {
+  Id (*exits[4])(Space *) = {space_get_north, space_get_south, space_get_east, space_get_west};
+  Link *link = NULL;
+  int i, d;
+
+  /* The spaces of a session point to the links of its world */
+  if (!game || game->shared)
+    return ERROR;
+
+  for (i = 0; i < game->n_spaces; i++) {
+    for (d = 0; d < 4; d++) {
+      link = game_get_link(game, exits[d](game->spaces[i]));
+      space_set_link(game->spaces[i], N + d, link, game_get_space(game, link_getDestination(link)));
+    }
   }
 
-  return NULL;
+  return OK;
 }
 
 /*----------------------------------------------------------------------------------------------------------*/
@@ -352,12 +735,10 @@ Object *game_get_object(Game *game, Id id) {
   if (id == NO_ID)
     return NULL;
 
-  for (i = 0; i < MAX_OBJECTS && game->objects[i] != NULL; i++) {
-    if (id == object_get_id(game->objects[i]))
-      return game->objects[i];
-  }
+  if ((i = idmap_get(game->object_ids, id)) < 0)
+    return NULL;
 
-  return NULL;
+  return game->objects[i];
 }
 
 /*----------------------------------------------------------------------------------------------------------*/
@@ -374,12 +755,10 @@ Enemy *game_get_enemy(Game *game, Id id) {
   if (id == NO_ID)
     return NULL;
 
-  for (i = 0; i < MAX_ENEMY && game->enemy[i] != NULL; i++) {
-    if (id == enemy_getId(game->enemy[i]))
-      return game->enemy[i];
-  }
+  if ((i = idmap_get(game->enemy_ids, id)) < 0)
+    return NULL;
 
-  return NULL;
+  return game->enemy[i];
 }
 
 /*----------------------------------------------------------------------------------------------------------*/
@@ -414,30 +793,49 @@ Id game_get_player_location(Game *game)
 /*----------------------------------------------------------------------------------------------------------*/
 
 /**
- * @brief It sets the space where the object is
+ * @brief It moves an object to a space, to the inventory of the player or out of the game
  * @param game Pointer to structure Game
- * @param id new Id where the object is
+ * @param id Id of the object
+ * @param location Id of the space, CARRIED or NO_ID
  * @return it returns OK if it goes well, else returns ERROR
  */
 STATUS game_set_object_location(Game *game, Id id, Id location)
 {
+  Id *where = NULL;
   int i;
-  
-  Space *aux = NULL;
-  if (id == NO_ID)
+
+  if (!game || id == NO_ID || (i = idmap_get(game->object_ids, id)) < 0)
   {
     return ERROR;
   }
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
+
+  where = &game->object_locations[i];
+  if (*where == location)
   {
-    if (game_get_space_id_at(game, i) == location)
-    {
-      aux = game->spaces[i];
-      break;
-    }
+    return OK;
+  }
+
+  /* It is put in its new place first, so that if there is no room it stays where it was */
+  if (location == CARRIED && player_addObject(game->play, id) == ERROR)
+  {
+    return ERROR;
+  }
+  if (location != CARRIED && location != NO_ID && space_add_object(game_own_space(game, location), id) == ERROR)
+  {
+    return ERROR;
+  }
+
+  if (*where == CARRIED)
+  {
+    player_deleteObject(game->play, id);
   }
+  else if (*where != NO_ID)
+  {
+    space_delete_object(game_own_space(game, *where), id);
+  }
+  *where = location;
 
-  return space_add_object(aux, id);
+  return OK;
 }
 
 /*----------------------------------------------------------------------------------------------------------*/
@@ -445,30 +843,18 @@ STATUS game_set_object_location(Game *game, Id id, Id location)
 /**
  * @brief It gets the space where the object is
  * @param game Pointer to structure Game
- * @return it returns the ID of the space the object is
+ * @return it returns the ID of the space the object is, CARRIED or NO_ID
  */
 Id game_get_object_location(Game *game, Id id)
 {
   int i;
 
-  if (!game)
+  if (!game || (i = idmap_get(game->object_ids, id)) < 0)
   {
     return NO_ID;
   }
 
-  if (player_hasObject(game->play, id))
-  {
-    return CARRIED;
-  }
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
-  {
-    if (space_has_object(game->spaces[i], id))
-    {
-      return game_get_space_id_at(game, i);
-    }
-  }
-
-  return NO_ID;
+  return game->object_locations[i];
 }
 
 /*----------------------------------------------------------------------------------------------------------*/
@@ -509,6 +895,14 @@ STATUS game_update(Game *game, T_Command cmd)
   }
   game->description[0] = '\0';
 
+  /* Only the commands that do nothing need no more than the first space and the player */
+  if (game->loader && cmd != NO_CMD && cmd != UNKNOWN && cmd != EXIT && game_finish_load(game, TRUE) == ERROR)
+  {
+    /* Without the rest of the world no command can be run */
+    game->cmd_st = ERROR;
+    return ERROR;
+  }
+
   switch (cmd)
   {
   case UNKNOWN:
@@ -551,6 +945,13 @@ STATUS game_update(Game *game, T_Command cmd)
     break;
   }
 
+  /* Without the levels around the player it may be in a space that is not in the game */
+  if (game->levels && levels_update(game->levels, game) == ERROR)
+  {
+    game->cmd_st = ERROR;
+    return ERROR;
+  }
+
   return OK;
 }
 
@@ -579,12 +980,12 @@ void game_print_data(Game *game)
   printf("\n\n-------------\n\n");
 
   printf("=> Spaces: \n");
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
+  for (i = 0; i < game->n_spaces; i++)
   {
     space_print(game->spaces[i]);
   }
 
-  for (i = 0; i < MAX_OBJECTS && game->objects[i] != NULL; i++)
+  for (i = 0; i < game->n_objects; i++)
   {
     printf("=> Object %d location: %d\n", (int)object_get_id(game->objects[i]), (int)game_get_object_location(game, object_get_id(game->objects[i])));
   }
@@ -671,14 +1072,17 @@ void game_command_take(Game *g)
     return;
   }
 
-  if ((game_get_object_location(g, object_id) != space_id) || (space_has_object(game_get_space(g, space_id), object_id) == FALSE))
+  if (game_get_object_location(g, object_id) != space_id)
   {
     g->cmd_st = ERROR;
     return;
   }
 
-  space_delete_object(game_get_space(g, space_id), object_id);
-  player_addObject(g->play, object_id);
+  if (game_set_object_location(g, object_id, CARRIED) == ERROR)
+  {
+    g->cmd_st = ERROR;
+    return;
+  }
 
   buff_type = bd_getType(object_getBuff(object));
   nerf_type = bd_getType(object_getDebuff(object));
@@ -767,8 +1171,11 @@ void game_command_drop(Game *g)
     return;
   }
 
-  space_add_object(game_get_space(g, space_id), object_id);
-  player_deleteObject(g->play, object_id);
+  if (game_set_object_location(g, object_id, space_id) == ERROR)
+  {
+    g->cmd_st = ERROR;
+    return;
+  }
 
   buff_type = bd_getType(object_getBuff(object));
   nerf_type = bd_getType(object_getDebuff(object));
@@ -818,7 +1225,9 @@ void game_command_drop(Game *g)
  */
 void game_command_move(Game *g) {
   Id current_id = NO_ID;
-  Id space_id = NO_ID, link_id = NO_ID, req = NO_ID, aux = NO_ID;
+  Id space_id = NO_ID, req = NO_ID, aux = NO_ID;
+  Space *space = NULL;
+  Link *link = NULL;
   long first_digit = 0;
   char direction;
 
@@ -832,7 +1241,7 @@ void game_command_move(Game *g) {
   space_id = game_get_player_location(g);
   g->description[0] = '\0';
 
-  if (NO_ID == space_id)
+  if (NO_ID == space_id || (space = game_get_space(g, space_id)) == NULL)
   { 
     printf("Error 0");
     g->cmd_st = ERROR;
@@ -844,17 +1253,17 @@ void game_command_move(Game *g) {
   if (direction == 'u' || direction == 'U') {
 
     if(player_isHere(g->play, 2, 1) == TRUE) {
-      link_id = space_get_north(game_get_space(g, space_id));
-      if (link_id != NO_ID) {
-        if(link_getOpen(game_get_link(g, link_id)) == FALSE) {
-          aux = req = link_getRequirement(game_get_link(g, link_id));
+      link = space_get_link(space, N);
+      if (link != NULL) {
+        if(link_getOpen(link) == FALSE) {
+          aux = req = link_getRequirement(link);
           while (aux != 0) {
               first_digit = aux % 10;
               aux /= 10;
           }
           if (first_digit == 2) {
             if(player_hasObject(g->play, req) == TRUE) {
-              link_setOpen(game_get_link(g, link_id), TRUE);
+              game_set_link_open(g, link_getId(link), TRUE);
             }
             else { 
               fprintf(stdout, "You need to have the object %s to open this door\n", object_get_name(game_get_object(g, req)));
@@ -864,7 +1273,7 @@ void game_command_move(Game *g) {
           }
           else if(first_digit == 4) {
             if(enemy_getHealth(game_get_enemy(g, req)) == 0) {
-              link_setOpen(game_get_link(g, link_id), TRUE);
+              game_set_link_open(g, link_getId(link), TRUE);
             }
             else {
               fprintf(stdout, "You need to kill the enemy %s to open this door\n", enemy_getName(game_get_enemy(g, req)));
@@ -877,9 +1286,11 @@ void game_command_move(Game *g) {
             g->cmd_st = ERROR;
             return;
           }
+          /* Opening it in a session may have copied the link and its space */
+          link = space_get_link(game_get_space(g, space_id), N);
         }
-        if(link_getOpen(game_get_link(g, link_id)) == TRUE) {
-          if((current_id = link_getDestination(game_get_link(g, link_id))) == NO_ID) {
+        if(link_getOpen(link) == TRUE) {
+          if((current_id = link_getDestination(link)) == NO_ID) {
             printf("Error 5");
             g->cmd_st = ERROR;
             return;
@@ -907,17 +1318,17 @@ void game_command_move(Game *g) {
   /*DOWN*/
   else if (direction == 'd' || direction == 'D') {
     if(player_isHere(g->play, 2, 1)) {
-      link_id = space_get_south(game_get_space(g, space_id));
-      if (link_id != NO_ID) {
-        if(link_getOpen(game_get_link(g, link_id)) == FALSE) {
-          aux = req = link_getRequirement(game_get_link(g, link_id));
+      link = space_get_link(space, S);
+      if (link != NULL) {
+        if(link_getOpen(link) == FALSE) {
+          aux = req = link_getRequirement(link);
           while (aux != 0) {
               first_digit = aux % 10;
               aux /= 10;
           }
           if (first_digit == 2) {
             if(player_hasObject(g->play, req) == TRUE) {
-              link_setOpen(game_get_link(g, link_id), TRUE);
+              game_set_link_open(g, link_getId(link), TRUE);
             }
             else { 
               fprintf(stdout, "You need to have the object %s to open this door", object_get_name(game_get_object(g, req)));
@@ -927,7 +1338,7 @@ void game_command_move(Game *g) {
           }
           else if(first_digit == 4) {
             if(enemy_getHealth(game_get_enemy(g, req)) <= 0) {
-              link_setOpen(game_get_link(g, link_id), TRUE);
+              game_set_link_open(g, link_getId(link), TRUE);
             }
             else {
               fprintf(stdout, "You need to kill the enemy %s to open this door", enemy_getName(game_get_enemy(g, req)));
@@ -940,9 +1351,11 @@ void game_command_move(Game *g) {
             g->cmd_st = ERROR;
             return;
           }
+          /* Opening it in a session may have copied the link and its space */
+          link = space_get_link(game_get_space(g, space_id), S);
         }
-        if(link_getOpen(game_get_link(g, link_id)) == TRUE) {
-          if((current_id = link_getDestination(game_get_link(g, link_id))) == NO_ID) {
+        if(link_getOpen(link) == TRUE) {
+          if((current_id = link_getDestination(link)) == NO_ID) {
             printf("Error 5");
             g->cmd_st = ERROR;
             return;
@@ -970,17 +1383,17 @@ void game_command_move(Game *g) {
   else if (direction == 'l' || direction == 'L') {
 
     if(player_isHere(g->play, 1, 0)) {
-      link_id = space_get_west(game_get_space(g, space_id));
-      if (link_id != NO_ID) {
-        if(link_getOpen(game_get_link(g, link_id)) == FALSE) {
-          aux = req = link_getRequirement(game_get_link(g, link_id));
+      link = space_get_link(space, W);
+      if (link != NULL) {
+        if(link_getOpen(link) == FALSE) {
+          aux = req = link_getRequirement(link);
           while (aux != 0) {
               first_digit = aux % 10;
               aux /= 10;
           }
           if (first_digit == 2) {
             if(player_hasObject(g->play, req) == TRUE) {
-              link_setOpen(game_get_link(g, link_id), TRUE);
+              game_set_link_open(g, link_getId(link), TRUE);
             }
             else { 
               fprintf(stdout, "You need to have the object %s to open this door", object_get_name(game_get_object(g, req)));
@@ -990,7 +1403,7 @@ void game_command_move(Game *g) {
           }
           else if(first_digit == 4) {
             if(enemy_getHealth(game_get_enemy(g, req)) <= 0) {
-              link_setOpen(game_get_link(g, link_id), TRUE);
+              game_set_link_open(g, link_getId(link), TRUE);
             }
             else {
               fprintf(stdout, "You need to kill the enemy %s to open this door", enemy_getName(game_get_enemy(g, req)));
@@ -1003,9 +1416,11 @@ void game_command_move(Game *g) {
             g->cmd_st = ERROR;
             return;
           }
+          /* Opening it in a session may have copied the link and its space */
+          link = space_get_link(game_get_space(g, space_id), W);
         }
-        if(link_getOpen(game_get_link(g, link_id)) == TRUE) {
-          if((current_id = link_getDestination(game_get_link(g, link_id))) == NO_ID) {
+        if(link_getOpen(link) == TRUE) {
+          if((current_id = link_getDestination(link)) == NO_ID) {
             printf("Error 5");
             g->cmd_st = ERROR;
             return;
@@ -1032,17 +1447,17 @@ void game_command_move(Game *g) {
   /*RIGHT*/
   else if (direction == 'r' || direction == 'R') {
     if(player_isHere(g->play, 1, 2))  {
-      link_id = space_get_east(game_get_space(g, space_id));
-      if (link_id != NO_ID) {
-        if(link_getOpen(game_get_link(g, link_id)) == FALSE) {
-          aux = req = link_getRequirement(game_get_link(g, link_id));
+      link = space_get_link(space, E);
+      if (link != NULL) {
+        if(link_getOpen(link) == FALSE) {
+          aux = req = link_getRequirement(link);
           while (aux != 0) {
               first_digit = aux % 10;
               aux /= 10;
           }
           if (first_digit == 2) {
             if(player_hasObject(g->play, req) == TRUE) {
-              link_setOpen(game_get_link(g, link_id), TRUE);
+              game_set_link_open(g, link_getId(link), TRUE);
             }
             else { 
               fprintf(stdout, "You need to have the object %s to open this door", object_get_name(game_get_object(g, req)));
@@ -1052,7 +1467,7 @@ void game_command_move(Game *g) {
           }
           else if(first_digit == 4) {
             if(enemy_getHealth(game_get_enemy(g, req)) <= 0) {
-              link_setOpen(game_get_link(g, link_id), TRUE);
+              game_set_link_open(g, link_getId(link), TRUE);
             }
             else {
               fprintf(stdout, "You need to kill the enemy %s to open this door", enemy_getName(game_get_enemy(g, req)));
@@ -1065,9 +1480,11 @@ void game_command_move(Game *g) {
             g->cmd_st = ERROR;
             return;
           }
+          /* Opening it in a session may have copied the link and its space */
+          link = space_get_link(game_get_space(g, space_id), E);
         }
-        if(link_getOpen(game_get_link(g, link_id)) == TRUE) {
-          if((current_id = link_getDestination(game_get_link(g, link_id))) == NO_ID) {
+        if(link_getOpen(link) == TRUE) {
+          if((current_id = link_getDestination(link)) == NO_ID) {
             printf("Error 5");
             g->cmd_st = ERROR;
             return;
@@ -1234,7 +1651,7 @@ void game_command_combat(Game *g) {
 
         enemy_setHealth(enemy, enemy_getHealth(enemy) - dmg);
         if(enemy_getHealth(enemy) <= 0) {
-          enemy_setLocation(enemy, DEAD);
+          game_set_enemy_location(g, enemy, DEAD);
         }
       }
       if(prob <= 4) {
@@ -1300,7 +1717,7 @@ void game_command_combat(Game *g) {
 
         enemy_setHealth(enemy, enemy_getHealth(enemy) - dmg);
         if(enemy_getHealth(enemy) <= 0) {
-          enemy_setLocation(enemy, DEAD);
+          game_set_enemy_location(g, enemy, DEAD);
         }
       }
       if(prob <= 9) {
@@ -1385,7 +1802,7 @@ void game_command_use(Game *g) {
     return;
   }
 
-  player_deleteObject(g->play, object_id);
+  game_set_object_location(g, object_id, NO_ID);
 
   buff_type = bd_getType(object_getBuff(object));
   nerf_type = bd_getType(object_getDebuff(object));
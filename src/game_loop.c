@@ -14,21 +14,55 @@
 int main(int argc, char *argv[]) {
   Game game;
   Graphic_engine *gengine;
+  Watcher *watcher;
   FILE *glog;
+  LOAD_MODE mode = LOAD_CACHED;
+  int arg = 1;
 
   glog = fopen("game.log", "a");
   if(!glog)
     return -1;
 
-  if (argc < 2) {
-    fprintf(stderr, "Use: %s <game_data_file>\n", argv[0]);
+#ifdef WORLD_EMBEDDED
+  /*the world is built into the program, there is no data file to read or watch*/
+  (void)argc;
+  (void)argv;
+  (void)arg;
+  (void)watcher;
+  if (!game_loop_init(&game, &gengine, NULL, mode)) {
+    game_loop_run(&game, gengine, glog, NULL);
+    game_loop_cleanup(game, gengine, glog);
+  }
+#else
+  if (argc > 2 && strcmp(argv[arg], "-m") == 0) { /*maps the data file instead of using its compiled copy*/
+    mode = LOAD_MMAP;
+    arg++;
+  } else if (argc > 2 && strcmp(argv[arg], "-p") == 0) { /*parses the data file on every processor*/
+    mode = LOAD_PARALLEL;
+    arg++;
+  } else if (argc > 2 && strcmp(argv[arg], "-t") == 0) { /*reads the data file line by line*/
+    mode = LOAD_STREAM;
+    arg++;
+  } else if (argc > 2 && strcmp(argv[arg], "-l") == 0) { /*loads only the levels around the player*/
+    mode = LOAD_LEVELS;
+    arg++;
+  } else if (argc > 2 && strcmp(argv[arg], "-a") == 0) { /*shows the first space while the rest is loaded*/
+    mode = LOAD_ASYNC;
+    arg++;
+  }
+
+  if (argc <= arg) {
+    fprintf(stderr, "Use: %s [-m | -p | -t | -l | -a] <game_data_file>\n", argv[0]);
     return 1;
   }
  
-  if (!game_loop_init(&game, &gengine, argv[1])) { /*if not 0, initializes the game*/
-    game_loop_run(game, gengine, glog); /*Initializes the game*/
+  if (!game_loop_init(&game, &gengine, argv[arg], mode)) { /*if not 0, initializes the game*/
+    watcher = watcher_create(argv[arg]); /*NULL if the data file cannot be watched, then it is not reloaded*/
+    game_loop_run(&game, gengine, glog, watcher); /*Initializes the game*/
+    watcher_destroy(watcher);
     game_loop_cleanup(game, gengine, glog); /*Destroys the game*/
   }
+#endif
 
   return 0;
 }
@@ -37,11 +71,18 @@ int main(int argc, char *argv[]) {
  * @brief Initializes the game and the graphic engine
  * @param game Pointer to stucture Game
  * @param gengine Matrix Pointer to structure graphic engine
- * @param file_name Name of the file where it's gonna be played
+ * @param file_name Name of the file where it's gonna be played, not used when the world is built in
+ * @param mode Loader used to read the file
  * @return Returns 0 if it initializes, else returns ERROR
 */
-int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name) {
-  if (game_create_from_file(game, file_name) == ERROR) { /*fails creating the game from a file*/
+int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name, LOAD_MODE mode) {
+#ifdef WORLD_EMBEDDED
+  (void)file_name;
+  (void)mode;
+  if (game_create_embedded(game) == ERROR) { /*fails creating the game from the world built in*/
+#else
+  if (game_create_from_file_mode(game, file_name, mode) == ERROR) { /*fails creating the game from a file*/
+#endif
     fprintf(stderr, "Error while initializing game.\n");
     return 1;
   }
@@ -59,25 +100,36 @@ int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name) {
  * @brief It runs the game on a loop until it receives the command EXIT
  * @param game Pointer to stucture Game
  * @param gengine Matrix Pointer to structure graphic engine
+ * @param watcher Watcher of the data file, its changes are applied before every turn. It can be NULL
 */
-void game_loop_run(Game game, Graphic_engine *gengine, FILE *f) {
+void game_loop_run(Game *game, Graphic_engine *gengine, FILE *f, Watcher *watcher) {
   T_Command command = NO_CMD;
   char str[6];
   extern char *cmd_to_str[N_CMD][N_CMDT];
 
-  while ((command != EXIT) && !game_is_over(&game)) {
-    graphic_engine_paint_game(gengine, &game);
+  while ((command != EXIT) && !game_is_over(game)) {
+    if (watcher && watcher_poll(watcher, game) == OK && watcher_get_changes(watcher) > 0) {
+      fprintf(f, " RELOAD %d records\n", watcher_get_changes(watcher));
+    }
+    if (game->loader && game_finish_load(game, FALSE) == ERROR) {
+      fprintf(f, " LOAD ERROR\n");
+      break;
+    }
+    graphic_engine_paint_game(gengine, game);
     command = command_get_user_input();
 
-    game_update(&game, command); 
-    if(game.cmd_st == ERROR)
+    if (game_update(game, command) == ERROR) {
+      fprintf(f, " LOAD ERROR\n");
+      break;
+    }
+    if(game->cmd_st == ERROR)
       strcpy(str, "ERROR");
     else
       strcpy(str, "OK");
 
     fprintf(f, " %s (%s) = %s\n", cmd_to_str[command - NO_CMD][CMDL], cmd_to_str[command - NO_CMD][CMDS], str);
 
-    if(game_is_over(&game))
+    if(game_is_over(game))
       printf("\n<<++++++++++++++++++>>\n\n      GAME OVER     \n\n<<++++++++++++++++++>>\n\n");
   }
 }
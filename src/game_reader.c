@@ -1,468 +1,461 @@
+/**
+ * @brief It implements the game reader, loading a game from a data file
+ *
+ * The data file is read in a single pass: every line is dispatched on its
+ * record tag (#s:, #o:, #p:, #e:, #l:). References to spaces that might not
+ * have been read yet (objects placed in a space, links attached to their
+ * origin) are queued and resolved once the whole file has been read.
+ *
+ * The file can also be mapped in memory instead of read line by line: the
+ * records are then split in (pointer, length) fields without copying them,
+ * and names are interned in a string table shared by the whole load.
+ *
+ * The graphic description of the spaces is never copied while loading: the
+ * position of its lines in the file is kept in the art store of the game and
+ * they are read the first time the space is shown.
+ *
+ * Large files can be split in chunks at record boundaries that are parsed
+ * by a pool of threads and merged back in file order.
+ *
+ * By default a compiled copy of the data file is kept next to it (<file>.bin)
+ * and loaded instead of the text while the data file stays the same.
+ *
+ * The game can also start with just the player and its space while the rest
+ * is parsed on a background thread.
+ *
+ * @file game_reader.c
+ * @author Profesores PPROG
+ * @version 3.0
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
 #include "game_reader.h"
 
-STATUS game_create_from_file(Game *game, char *filename)
-{
-  if (game_create(game) == ERROR)
-  {
-    return ERROR;
-  }
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-  if (game_load_spaces(game, filename) == ERROR)
-  {
-    return ERROR;
+/**
+ * @brief Splits the line of a record in fields and ends every field with a NUL, so they can be used as strings
+ * @param line Line read, starting with its tag
+ * @param f Where the fields are stored, the missing ones are left empty
+ * @param max Number of fields of the record
+ */
+static void game_fields(char *line, ScanField *f, int max) {
+  int i, n;
+
+  n = scan_fields(line + 3, line + strlen(line), f, max);
+  for (i = 0; i < max; i++) {
+    if (i < n)
+      ((char *)f[i].s)[f[i].len] = '\0';
+    else
+      f[i].s = "";
   }
+}
 
-  if (game_load_objects(game, filename) == ERROR)
-  {
-    return ERROR;
-  }
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-  if (game_load_player(game, filename) == ERROR)
-  {
-    return ERROR;
-  }
+static long game_long(const ScanField *f) {
+  return scan_long(f->s, f->len);
+}
 
-  if (game_load_enemy(game, filename) == ERROR)
-  {
-    return ERROR;
-  }
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-  if (game_load_links(game, filename) == ERROR)
-  {
-    return ERROR;
+static float game_float(const ScanField *f) {
+  return scan_float(f->s, f->len);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+static STATUS game_read_space(Game *game, char *line, FILE *file) {
+  W_Space rec;
+  ScanField f[3];
+  char skip[WORD_SIZE];
+  int i;
+
+  game_fields(line, f, 3);
+  rec.id = game_long(&f[0]);
+  rec.name = f[1].s;
+  rec.nlines = game_long(&f[2]);
+  rec.gdesc = NULL;
+  rec.offset = ftell(file);
+
+#ifdef DEBUG
+  printf("Leido: %ld|%s|%d\n", rec.id, rec.name, rec.nlines);
+#endif
+  /* The graphic description is skipped, it is read from the file when the space is shown.
+   * The name still points into line */
+  for (i = 0; i < rec.nlines; i++) {
+    if (!fgets(skip, WORD_SIZE, file))
+      break;
   }
+  rec.nlines = i;
 
-  return OK;
+  return world_add_space(game, &rec);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-#include "game_reader.h"
+static STATUS game_read_object(Game *game, char *line, W_Fixups *placed) {
+  W_Object rec;
+  ScanField f[11];
+
+  game_fields(line, f, 11);
+  rec.id = game_long(&f[0]);
+  rec.name = f[1].s;
+  rec.location = game_long(&f[2]);
+  rec.type = game_long(&f[3]);
+  rec.buff_type = game_long(&f[4]);
+  rec.buff_value = game_float(&f[5]);
+  rec.debuff_type = game_long(&f[6]);
+  rec.debuff_value = game_float(&f[7]);
+  rec.consumable = game_long(&f[8]);
+  rec.i = game_long(&f[9]);
+  rec.j = game_long(&f[10]);
+
+#ifdef DEBUG
+  printf("Leido: %ld|%s|%ld|%d|%d|%f|%d|%f|%d|%d|%d\n", rec.id, rec.name, rec.location, rec.type, rec.buff_type, rec.buff_value, rec.debuff_type, rec.debuff_value, rec.consumable, rec.i, rec.j);
+#endif
+  return world_add_object(game, &rec, placed);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+static STATUS game_read_player(Game *game, char *line) {
+  W_Player rec;
+  ScanField f[9];
+
+  game_fields(line, f, 9);
+  rec.id = game_long(&f[0]);
+  rec.name = f[1].s;
+  rec.location = game_long(&f[2]);
+  rec.health = game_long(&f[3]);
+  rec.capacity = game_long(&f[4]);
+  rec.attack = game_float(&f[5]);
+  rec.defense = game_float(&f[6]);
+  rec.i = game_long(&f[7]);
+  rec.j = game_long(&f[8]);
+
+#ifdef DEBUG
+  printf("Leido: %ld|%s|%ld|%d|%d|%f|%f|%d|%d\n", rec.id, rec.name, rec.location, rec.health, rec.capacity, rec.attack, rec.defense, rec.i, rec.j);
+#endif
+  return world_add_player(game, &rec);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+static STATUS game_read_enemy(Game *game, char *line) {
+  W_Enemy rec;
+  ScanField f[8];
+
+  game_fields(line, f, 8);
+  rec.id = game_long(&f[0]);
+  rec.name = f[1].s;
+  rec.location = game_long(&f[2]);
+  rec.health = game_long(&f[3]);
+  rec.attack = game_float(&f[4]);
+  rec.defense = game_float(&f[5]);
+  rec.i = game_long(&f[6]);
+  rec.j = game_long(&f[7]);
+
+#ifdef DEBUG
+  printf("Leido: %ld|%s|%ld|%d|%f|%f|%d|%d\n", rec.id, rec.name, rec.location, rec.health, rec.attack, rec.defense, rec.i, rec.j);
+#endif
+  return world_add_enemy(game, &rec);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+static STATUS game_read_link(Game *game, char *line, W_Fixups *attached) {
+  W_Link rec;
+  ScanField f[7];
+
+  game_fields(line, f, 7);
+  rec.id = game_long(&f[0]);
+  rec.name = f[1].s;
+  rec.origin = game_long(&f[2]);
+  rec.destination = game_long(&f[3]);
+  rec.dir = game_long(&f[4]);
+  rec.open = game_long(&f[5]);
+  rec.requirement = game_long(&f[6]);
+
+#ifdef DEBUG
+  printf("Leido: %ld|%s|%ld|%ld|%d|%d|%ld|\n", rec.id, rec.name, rec.origin, rec.destination, rec.dir, rec.open, rec.requirement);
+#endif
+  return world_add_link(game, &rec, attached);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
 STATUS game_create_from_file(Game *game, char *filename) {
+  return game_create_from_file_mode(game, filename, LOAD_CACHED);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+STATUS game_create_from_file_mode(Game *game, char *filename, LOAD_MODE mode) {
+  STATUS status = ERROR;
+
   if (game_create(game) == ERROR) {
     return ERROR;
   }
 
-  if (game_load_spaces(game, filename) == ERROR) {
+  if ((game->art = art_create(filename, ART_MAX_RESIDENT)) == NULL) {
+    game_destroy(game);
     return ERROR;
   }
 
-  if(game_load_objects(game, filename) == ERROR) {
-    return ERROR;
+  if (mode == LOAD_MMAP) {
+    status = game_load_mapped(game, filename);
   }
-
-  if (game_load_player(game, filename) == ERROR) {
-    return ERROR;
+  else if (mode == LOAD_PARALLEL) {
+    status = game_load_parallel(game, filename);
   }
-
-  if(game_load_enemy(game, filename) == ERROR) {
-    return ERROR;
+  else if (mode == LOAD_CACHED) {
+    status = game_load_cached(game, filename);
+  }
+  else if (mode == LOAD_LEVELS) {
+    status = game_load_levels(game, filename);
+  }
+  else if (mode == LOAD_ASYNC) {
+    status = game_load_async(game, filename);
+  }
+  else {
+    status = game_load(game, filename);
   }
 
-  if(game_load_links(game, filename) == ERROR) {
+  if (status == ERROR) {
+    game_destroy(game);
     return ERROR;
   }
-  
-  return OK;
+
+  return game_resolve_links(game);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-STATUS game_load_spaces(Game *game, char *filename)
-{
+STATUS game_load(Game *game, char *filename) {
   FILE *file = NULL;
   char line[WORD_SIZE] = "";
-  char name[WORD_SIZE] = "";
-  char *toks = NULL;
-  int nlines = 0;
-  Id id = NO_ID;
-  Space *space = NULL;
+  W_Fixups placed = {NULL, 0, 0}, attached = {NULL, 0, 0};
   STATUS status = OK;
 
-  if (!filename)
-  {
+  if (!game || !filename) {
     return ERROR;
   }
 
   file = fopen(filename, "r");
-  if (file == NULL)
-  {
+  if (file == NULL) {
     return ERROR;
   }
 
-  while (fgets(line, WORD_SIZE, file))
-  {
-    if (strncmp("#s:", line, 3) == 0)
-    {
-      toks = strtok(line + 3, "|");
-      id = atol(toks);
-      toks = strtok(NULL, "|");
-      strcpy(name, toks);
-      toks = strtok(NULL, "|");
-      nlines = atoi(toks);
-
-#ifdef DEBUG
-      printf("Leido: %ld|%s|%s|%d\n", id, name, desc, nlines);
-#endif
-      space = space_create(id);
-      if (space != NULL)
-      {
-        space_set_name(space, name);
-        space_set_desc(space, name);
-        space_set_nlines(space, nlines);
-        for (int i = 0; i < nlines; i++)
-        {  
-          fgets(line, WORD_SIZE, file);
-          line[strlen(line)-1] = '\0';
-          space_set_gdesc(space, line, i);
-        }
-        game_add_space(game, space);
-      }
+  while (status == OK && fgets(line, WORD_SIZE, file)) {
+    if (line[0] != '#' || line[1] == '\0' || line[2] != ':')
+      continue;
+
+    switch (line[1]) {
+      case 's':
+        status = game_read_space(game, line, file);
+        break;
+      case 'o':
+        status = game_read_object(game, line, &placed);
+        break;
+      case 'p':
+        status = game_read_player(game, line);
+        break;
+      case 'e':
+        status = game_read_enemy(game, line);
+        break;
+      case 'l':
+        status = game_read_link(game, line, &attached);
+        break;
+      default:
+        break;
     }
   }
 
-  if (ferror(file))
-  {
+  if (ferror(file)) {
     status = ERROR;
   }
 
   fclose(file);
 
+  if (status == OK) {
+    world_fixup(game, &placed, &attached);
+  }
+
+  free(placed.items);
+  free(attached.items);
+
   return status;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-STATUS game_load_objects(Game *game, char *filename) 
-{
-  FILE *file = NULL;
-  char line[WORD_SIZE] = "";
-  char name[WORD_SIZE] = "";
-  char *toks = NULL;
-  int type, buff_type, debuff_type, i, j;
-  float buff_cant, debuff_cant;
-  BOOL consum;
-  Id id = NO_ID, id_loc = NO_ID;
-  Object *object = NULL;
-  BD *buff = NULL;
-  BD *debuff = NULL;
-  STATUS status = OK;
+/**
+ * @brief Maps a whole file in memory, read only
+ * @param filename Name of the file
+ * @param st Where the status of the file is stored
+ * @return the contents, NULL if the file is empty, or MAP_FAILED
+ */
+static void *game_map_file(char *filename, struct stat *st) {
+  void *data = NULL;
+  int fd;
 
-  if (!filename)
-  {
-    return ERROR;
+  if ((fd = open(filename, O_RDONLY)) < 0) {
+    return MAP_FAILED;
   }
 
-  file = fopen(filename, "r");
-  if (file == NULL)
-  {
-    return ERROR;
+  if (fstat(fd, st) < 0) {
+    close(fd);
+    return MAP_FAILED;
   }
 
-  while (fgets(line, WORD_SIZE, file))
-  {
-    if (strncmp("#o:", line, 3) == 0)
-    {
-      toks = strtok(line + 3, "|");
-      id = atol(toks);
-      toks = strtok(NULL, "|");
-      strcpy(name, toks);
-      toks = strtok(NULL, "|");
-      id_loc = atol(toks);
-      toks = strtok(NULL, "|");
-      type = atol(toks);
-      toks = strtok(NULL, "|");
-      buff_type = atol(toks);
-      toks = strtok(NULL, "|");
-      buff_cant = atof(toks);
-      toks = strtok(NULL, "|");
-      debuff_type = atol(toks);
-      toks = strtok(NULL, "|");
-      debuff_cant = atof(toks);
-      toks = strtok(NULL, "|");
-      consum = atol(toks);
-      toks = strtok(NULL, "|");
-      i = atof(toks);
-      toks = strtok(NULL, "|");
-      j = atol(toks);
-      toks = strtok(NULL, "|");
-      
-#ifdef DEBUG
-      printf("Leido: %ld|%s|%ld|%s|%d|%f|%d|%f|%d|%d|%d\n"|%s, id, name, id_loc, desc, buff, buff_cant, debuff, debuff_cant, consum, i, j);
-#endif
-      object = object_create(id);
-      if (object != NULL)
-      {
-        if((buff = bd_create()) == NULL)
-        {
-          object_destroy(object);
-          return ERROR;
-        }
-        if((debuff = bd_create()) == NULL)
-        {
-          object_destroy(object);
-          return ERROR;
-        }
-
-        object_set_name(object, name);
-        object_setType(object,type);
-
-        object_setBuff(object,buff);
-        object_setBuffType(object, buff_type);
-        object_setBuffValue(object, buff_cant);
-
-        object_setdebuff(object,debuff);
-        object_setdebuffType(object, debuff_type);
-        object_setdebuffValue(object, debuff_cant);
-
-        object_setIfConsumable(object, consum);
-        object_setPosition(object, i, j);
-        game_add_object(game, object);
-        space_add_object(game_get_space(game, id_loc), id);
-      }
-    }
+  if (st->st_size == 0) {
+    close(fd);
+    return NULL;
   }
 
-  if (ferror(file))
-  {
-    status = ERROR;
+  data = mmap(NULL, st->st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data != MAP_FAILED) {
+    madvise(data, st->st_size, MADV_SEQUENTIAL);
   }
 
-  fclose(file);
-
-  return status;
+  return data;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-STATUS game_load_player(Game *game, char *filename) 
-{
-  FILE *file = NULL;
-  char line[WORD_SIZE] = "";
-  char name[WORD_SIZE] = "";
-  char *toks = NULL;
-  Id id = NO_ID, id_loc = NO_ID;
-  int health, capacity, i, j;
-  float attack, defense;
-  Player *player = NULL;
-  Inventory *inventory = NULL;
+/**
+ * @brief Maps a data file, parses it into a world with the given number of threads and applies it
+ * @param nthreads Number of threads, 1 to parse it serially or 0 to use one per processor
+ */
+static STATUS game_load_world(Game *game, char *filename, int nthreads) {
+  struct stat st;
+  W_World *world = NULL;
+  void *data = NULL;
   STATUS status = OK;
 
-  if (!filename)
-  {
+  if (!game || !filename) {
     return ERROR;
   }
 
-  file = fopen(filename, "r");
-  if (file == NULL)
-  {
+  if ((data = game_map_file(filename, &st)) == MAP_FAILED) {
     return ERROR;
   }
 
-  while (fgets(line, WORD_SIZE, file))
-  {
-    if (strncmp("#p:", line, 3) == 0)
-    {
-      toks = strtok(line + 3, "|");
-      id = atol(toks);
-      toks = strtok(NULL, "|");
-      strcpy(name, toks);
-      toks = strtok(NULL, "|");
-      id_loc = atol(toks);
-      toks = strtok(NULL, "|");
-      health = atol(toks);
-      toks = strtok(NULL, "|");
-      capacity = atol(toks);
-      toks = strtok(NULL, "|");
-      attack = atof(toks);
-      toks = strtok(NULL, "|");
-      defense = atof(toks);
-      toks = strtok(NULL, "|");
-      i = atol(toks);
-      toks = strtok(NULL, "|");
-      j = atol(toks);
-      toks = strtok(NULL, "|");
-#ifdef DEBUG
-      printf("Leido: %ld|%s|%ld|%d|%d|%f|%f|%d|%d\n", id, name, id_loc, health, capacity, attack, defense, i, j);
-#endif
-      player = player_create(id);
-      if (player != NULL)
-      {
-        if((inventory = inventory_create()) == NULL)
-        {
-          player_destroy(player);
-          return ERROR;
-        }
-        player_setName(player, name);
-        player_setLocation(player, id_loc);
-        player_setPosition(player, i, j);
-        player_setHealth(player, health);
-        player_setAttack(player, attack);
-        player_setDefense(player,defense);
-        inventory_setCapacity(inventory, capacity);
-        player_setInventory(player, inventory);
-        game_add_player(game, player);
-      }
-    }
+  if ((world = world_create()) == NULL) {
+    if (data)
+      munmap(data, st.st_size);
+    return ERROR;
   }
 
-  if (ferror(file))
-  {
-    status = ERROR;
+  if (nthreads == 1)
+    status = world_parse(world, (const char *)data, st.st_size);
+  else
+    status = world_parse_parallel(world, (const char *)data, st.st_size, nthreads);
+  if (data)
+    munmap(data, st.st_size);
+
+  if (status == OK) {
+    status = world_apply(world, game);
   }
 
-  fclose(file);
+  world_destroy(world);
 
   return status;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-STATUS game_load_enemy(Game *game, char *filename) 
-{
-  FILE *file = NULL;
-  char line[WORD_SIZE] = "";
-  char name[WORD_SIZE] = "";
-  char *toks = NULL;
-  Id id = NO_ID, id_loc = NO_ID;
-  int health, i, j;
-  float attack, defense;
-  Enemy *enemy = NULL;
+STATUS game_load_mapped(Game *game, char *filename) {
+  return game_load_world(game, filename, 1);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+STATUS game_load_parallel(Game *game, char *filename) {
+  return game_load_world(game, filename, 0);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
+
+STATUS game_load_cached(Game *game, char *filename) {
+  struct stat st;
+  char cache[WORD_SIZE];
+  W_World *world = NULL;
+  WB_World *wb = NULL;
+  void *data = NULL;
+  uint64_t hash;
   STATUS status = OK;
 
-  if (!filename)
-  {
+  if (!game || !filename) {
     return ERROR;
   }
 
-  file = fopen(filename, "r");
-  if (file == NULL)
-  {
+  if ((data = game_map_file(filename, &st)) == MAP_FAILED) {
     return ERROR;
   }
+  hash = world_bin_hash((const char *)data, data ? st.st_size : 0);
 
-  while (fgets(line, WORD_SIZE, file))
-  {
-    if (strncmp("#e:", line, 3) == 0)
-    {
-      toks = strtok(line + 3, "|");
-      id = atol(toks);
-      toks = strtok(NULL, "|");
-      strcpy(name, toks);
-      toks = strtok(NULL, "|");
-      id_loc = atol(toks);
-      toks = strtok(NULL, "|");
-      health = atol(toks);
-      toks = strtok(NULL, "|");
-      attack = atof(toks);
-      toks = strtok(NULL, "|");
-      defense = atof(toks);
-      toks = strtok(NULL, "|");
-      i = atof(toks);
-      toks = strtok(NULL, "|");
-      j = atol(toks);
-      toks = strtok(NULL, "|");
-#ifdef DEBUG
-      printf("Leido: %ld|%s|%ld|%d|%f|%f|%d|%d\n", id, name, id_loc, health, i, j);
-#endif
-      enemy = enemy_create();
-      if (enemy != NULL)
-      {
-        enemy_setId(enemy, id);
-        enemy_setName(enemy, name);
-        enemy_setLocation(enemy, id_loc);
-        enemy_setHealth(enemy, health);
-        enemy_setAttack(enemy, attack);
-        enemy_setDefense(enemy, defense);
-        enemy_setPosition(enemy,i,j);
-        game_add_enemy(game, enemy);
-      }
-    }
+  snprintf(cache, WORD_SIZE, "%s" CACHE_EXT, filename);
+  if ((wb = world_bin_open(cache)) != NULL && world_bin_matches(wb, &st, hash) == TRUE) {
+    if (data)
+      munmap(data, st.st_size);
+    status = world_bin_apply(wb, game);
+    world_bin_close(wb);
+    return status;
   }
+  world_bin_close(wb);
 
-  if (ferror(file))
-  {
-    status = ERROR;
+  /* No valid cache: parse the text and compile it for the next time */
+  if ((world = world_create()) == NULL) {
+    if (data)
+      munmap(data, st.st_size);
+    return ERROR;
   }
 
-  fclose(file);
+  status = world_parse_parallel(world, (const char *)data, st.st_size, 0);
+  if (data)
+    munmap(data, st.st_size);
+
+  if (status == OK) {
+    status = world_apply(world, game);
+  }
+
+  if (status == OK) {
+    world_bin_write(world, cache, &st, hash);
+  }
+
+  world_destroy(world);
 
   return status;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-STATUS game_load_links(Game *game, char *filename) {
-  FILE *file = NULL;
-  char line[WORD_SIZE] = "";
-  char name[WORD_SIZE] = "";
-  char *toks = NULL;
-  Id id = NO_ID, orig = NO_ID, dest = NO_ID, req = NO_ID;
-  DIRECTION dir = UNKNOWN;
-  Link *link = NULL;
-  BOOL open = TRUE;
-  STATUS status = OK;
-
-  if (!filename) {
+STATUS game_load_levels(Game *game, char *filename) {
+  if (!game || !filename) {
     return ERROR;
   }
 
-  file = fopen(filename, "r");
-  if (file == NULL) {
+  if ((game->levels = levels_create(filename)) == NULL) {
     return ERROR;
   }
 
-  while (fgets(line, WORD_SIZE, file)) {
-    if (strncmp("#l:", line, 3) == 0) {
-      toks = strtok(line + 3, "|");
-      id = atol(toks);
-      toks = strtok(NULL, "|");
-      strcpy(name, toks);
-      toks = strtok(NULL, "|");
-      orig = atol(toks);
-      toks = strtok(NULL, "|");
-      dest = atol(toks);
-      toks = strtok(NULL, "|");
-      dir = atol(toks);
-      toks = strtok(NULL, "|");
-      open = atol(toks);
-      toks = strtok(NULL, "|");
-      req = atol(toks);
-      toks = strtok(NULL, "|");
+  return levels_start(game->levels, game);
+}
 
-#ifdef DEBUG
-      printf("Leido: %ld|%s|%ld|%ld|%d|%d|%ld|", id, name, orig, dest, dir, open, req);
-#endif
-      link = link_create();
-      if (link != NULL) {
-        link_setName(link, name);
-        link_setId(link, id);
-        link_setOrigin(link, orig);
-        link_setDestination(link, dest);
-        link_setDirection(link, dir);
-        link_setOpen(link, open);
-        link_setRequirement(link, req);
-
-        if(dir == 1)
-          space_set_north(game_get_space(game, orig), id);
-        else if(dir == 2)
-          space_set_south(game_get_space(game, orig), id);
-        else if(dir == 3)
-          space_set_east(game_get_space(game, orig), id);
-        else if(dir == 4)
-          space_set_west(game_get_space(game, orig), id);
-  
-        game_add_link(game, link);
-      }
-    }
-  }
+/*--------------------------------------------------------------------------------------------------------------------------------------------------------*/
 
-  if (ferror(file)) {
-    status = ERROR;
+STATUS game_load_async(Game *game, char *filename) {
+  if (!game || !filename) {
+    return ERROR;
   }
 
-  fclose(file);
+  if ((game->loader = loader_start(game, filename)) == NULL) {
+    return ERROR;
+  }
 
-  return status;
+  return OK;
 }
@@ -71,12 +71,37 @@ void graphic_engine_destroy(Graphic_engine *ge)
   free(ge);
 }
 
+/**
+ * @brief Where graphic_engine_put_object writes the objects of a space
+ */
+typedef struct
+{
+  Area *area; /*Area where the lines go*/
+  Game *game; /*Game the objects are in*/
+} ObjectLines;
+
+/**
+ * @brief Writes the line of an object that can be found in the current space
+ */
+static BOOL graphic_engine_put_object(Id id, void *data)
+{
+  ObjectLines *lines = (ObjectLines *)data;
+  char str[MAX_STR];
+
+  sprintf(str, "  Object %s can be found in this room", object_get_name(game_get_object(lines->game, id)));
+  screen_area_puts(lines->area, str);
+
+  return TRUE;
+}
+
 void graphic_engine_paint_game(Graphic_engine *ge, Game *game)
 {
   Id id_act = NO_ID, id_north = NO_ID, id_south = NO_ID, id_east = NO_ID, id_west = NO_ID, player_loc = NO_ID, enemy_loc = NO_ID, id_start = 1122;
   int hp_player, hp_enemy, i = 0, nlines, num_obj, interaction, lines1, lines2, lines3, player_xp, player_def, player_atk;
   Space *space_act = NULL;
-  Id *inv = NULL, *obj_in_space = NULL;
+  Enemy *enemy_act = NULL;
+  Id *inv = NULL;
+  ObjectLines in_space;
   char enemy[4] = "";
   char status[6] = "";
   char desc[235] = "";
@@ -93,16 +118,21 @@ void graphic_engine_paint_game(Graphic_engine *ge, Game *game)
   if ((id_act = game_get_player_location(game)) != NO_ID)
   {
     space_act = game_get_space(game, id_act);
+    /*The space may be shared with other games, its enemy is looked for in this one*/
+    enemy_act = game_get_enemy(game, enemy_getId(space_get_enemy(space_act)));
 
     /*Sets the ids*/
-    id_north = link_getDestination(game_get_link(game, space_get_north(space_act)));
-    id_south = link_getDestination(game_get_link(game, space_get_south(space_act)));
-    id_east = link_getDestination(game_get_link(game, space_get_east(space_act)));
-    id_west = link_getDestination(game_get_link(game, space_get_west(space_act)));
+    id_north = link_getDestination(space_get_link(space_act, N));
+    id_south = link_getDestination(space_get_link(space_act, S));
+    id_east = link_getDestination(space_get_link(space_act, E));
+    id_west = link_getDestination(space_get_link(space_act, W));
 
     /*Gets space descrpition*/
 
     nlines = space_get_nlines(space_act);
+    /*Only the lines gdesc has room for are painted, the thirds are taken from them*/
+    if (nlines > (int)(sizeof(gdesc) / sizeof(gdesc[0])))
+      nlines = sizeof(gdesc) / sizeof(gdesc[0]);
     lines1 = (nlines - 6) / 3;
     lines2 = lines1 + lines1;
     lines3 = lines2 + lines1;
@@ -115,7 +145,7 @@ void graphic_engine_paint_game(Graphic_engine *ge, Game *game)
     /*Paints space design*/
     /***************************************************************************************************/
 
-    if (enemy_getLocation(game->enemy[0]) == id_act)
+    if (enemy_act != NULL)
       strcpy(enemy, "UAM");
     else
       strcpy(enemy, "   ");
@@ -226,7 +256,7 @@ void graphic_engine_paint_game(Graphic_engine *ge, Game *game)
     /*Paint the inspace area*/
 
     screen_area_clear(ge->inspace);
-    enemy_loc = enemy_getLocation(space_get_enemy(space_act));
+    enemy_loc = enemy_getLocation(enemy_act);
 
     if (id_act != id_start)
     {
@@ -249,7 +279,7 @@ void graphic_engine_paint_game(Graphic_engine *ge, Game *game)
         sprintf(str, "  | |");
         screen_area_puts(ge->inspace, str);
       }
-      else if (space_get_enemy(space_act) != NULL)
+      else if (enemy_act != NULL)
       {
         {
           sprintf(str, "   __");
@@ -426,16 +456,9 @@ void graphic_engine_paint_game(Graphic_engine *ge, Game *game)
     /*OBJECTS*/
     screen_area_clear(ge->descript);
 
-    obj_in_space = space_get_objects(space_act);
-
-    for (i = 0; i < num_obj; i++)
-    {
-      if (obj_in_space[i] != NO_ID)
-      {
-        sprintf(str, "  Object %s can be found in this room", object_get_name(game->objects[i]));
-        screen_area_puts(ge->descript, str);
-      }
-    }
+    in_space.area = ge->descript;
+    in_space.game = game;
+    set_foreach(space_get_set(space_act), graphic_engine_put_object, &in_space);
 
     /*ENEMY*/
     if (enemy_loc == player_getLocation(game->play))
@@ -452,7 +475,7 @@ void graphic_engine_paint_game(Graphic_engine *ge, Game *game)
       sprintf(str, "  ^^^^^^^^^^^^     /_OO_\\");
       screen_area_puts(ge->descript, str);
 
-      if (((hp_enemy = enemy_getHealth(space_get_enemy(space_act))) > 0) && (enemy_loc != NO_ID))
+      if (((hp_enemy = enemy_getHealth(enemy_act)) > 0) && (enemy_loc != NO_ID))
       {
         sprintf(str, "  Enemy HP:%d", hp_enemy);
         screen_area_puts(ge->descript, str);
@@ -0,0 +1,194 @@
+/**
+ * @brief Implements the id map module
+ *
+ * The ids are kept in an open addressing hash table with linear probing
+ * that doubles when it gets half full. Removing an id shifts back the ids
+ * that follow it in its run, so no deleted marks are left behind.
+ *
+ * @file idmap.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "idmap.h"
+
+#define IDMAP_SLOTS 64
+
+/**
+ * @brief Slot of the hash table
+ */
+typedef struct {
+    Id id;   /*Id stored*/
+    int pos; /*Its position, -1 if the slot is free*/
+} IdSlot;
+
+struct _IdMap
+{
+    IdSlot *slots; /*Hash table*/
+    int n_slots;   /*Size of the hash table, power of two*/
+    int n_ids;     /*Number of ids*/
+};
+
+/*----------------------------------------------------------------------------------------------------*/
+static int idmap_hash(const IdMap *map, Id id)
+{
+    /* Ids come in runs of close numbers, the multiplication spreads them over the table */
+    return (int)(((uint64_t)id * 0x9E3779B97F4A7C15ull) >> 32) & (map->n_slots - 1);
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+static IdSlot *idmap_alloc(int n_slots)
+{
+    IdSlot *slots;
+    int i;
+
+    slots = (IdSlot *)malloc(n_slots * sizeof(IdSlot));
+    if (!slots)
+        return NULL;
+
+    for (i = 0; i < n_slots; i++)
+        slots[i].pos = -1;
+
+    return slots;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+static int idmap_find(const IdMap *map, Id id)
+{
+    int i = idmap_hash(map, id);
+
+    while (map->slots[i].pos != -1 && map->slots[i].id != id)
+        i = (i + 1) & (map->n_slots - 1);
+
+    return i;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+static STATUS idmap_grow(IdMap *map)
+{
+    IdSlot *old = map->slots, *slots;
+    int n_old = map->n_slots, i, j;
+
+    if ((slots = idmap_alloc(2 * n_old)) == NULL)
+        return ERROR;
+
+    map->slots = slots;
+    map->n_slots = 2 * n_old;
+    for (i = 0; i < n_old; i++)
+    {
+        if (old[i].pos == -1)
+            continue;
+        j = idmap_find(map, old[i].id);
+        map->slots[j] = old[i];
+    }
+    free(old);
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+IdMap *idmap_create()
+{
+    IdMap *map;
+
+    map = (IdMap *)malloc(sizeof(IdMap));
+    if (!map)
+        return NULL;
+
+    if ((map->slots = idmap_alloc(IDMAP_SLOTS)) == NULL)
+    {
+        free(map);
+        return NULL;
+    }
+    map->n_slots = IDMAP_SLOTS;
+    map->n_ids = 0;
+
+    return map;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+STATUS idmap_destroy(IdMap *map)
+{
+    if (!map)
+        return ERROR;
+
+    free(map->slots);
+    free(map);
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+STATUS idmap_put(IdMap *map, Id id, int pos)
+{
+    int i;
+
+    if (!map || pos < 0)
+        return ERROR;
+
+    i = idmap_find(map, id);
+    if (map->slots[i].pos == -1)
+    {
+        if (2 * (map->n_ids + 1) > map->n_slots)
+        {
+            if (idmap_grow(map) == ERROR)
+                return ERROR;
+            i = idmap_find(map, id);
+        }
+        map->slots[i].id = id;
+        map->n_ids++;
+    }
+    map->slots[i].pos = pos;
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+int idmap_get(IdMap *map, Id id)
+{
+    if (!map)
+        return -1;
+
+    return map->slots[idmap_find(map, id)].pos;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+STATUS idmap_remove(IdMap *map, Id id)
+{
+    int i, j, home, mask;
+
+    if (!map)
+        return ERROR;
+
+    i = idmap_find(map, id);
+    if (map->slots[i].pos == -1)
+        return ERROR;
+
+    /* Every id after the hole that would not be found from its home slot is moved into it */
+    mask = map->n_slots - 1;
+    for (j = (i + 1) & mask; map->slots[j].pos != -1; j = (j + 1) & mask)
+    {
+        home = idmap_hash(map, map->slots[j].id);
+        if (((j - home) & mask) >= ((j - i) & mask))
+        {
+            map->slots[i] = map->slots[j];
+            i = j;
+        }
+    }
+    map->slots[i].pos = -1;
+    map->n_ids--;
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+int idmap_get_number(IdMap *map)
+{
+    if (!map)
+        return -1;
+
+    return map->n_ids;
+}
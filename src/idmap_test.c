@@ -0,0 +1,161 @@
+/** 
+ * @brief It tests the id map module
+ * 
+ * @file idmap_test.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+#include "idmap.h"
+#include "idmap_test.h"
+#include "test.h"
+
+#define MAX_TESTS 12
+
+/** 
+ * @brief Main function for IDMAP unit tests. 
+ * 
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed 
+ *   2.- A number means a particular test (the one identified by that number) 
+ *       is executed
+ *  
+ */
+int main(int argc, char** argv) {
+
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2) {
+    printf("Running all test for module IdMap:\n");
+  } else {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS) {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+
+  if (all || test == 1) test1_idmap_create();
+  if (all || test == 2) test1_idmap_destroy();
+  if (all || test == 3) test2_idmap_destroy();
+  if (all || test == 4) test1_idmap_put();
+  if (all || test == 5) test2_idmap_put();
+  if (all || test == 6) test3_idmap_put();
+  if (all || test == 7) test1_idmap_get();
+  if (all || test == 8) test2_idmap_get();
+  if (all || test == 9) test1_idmap_remove();
+  if (all || test == 10) test2_idmap_remove();
+  if (all || test == 11) test1_idmap_get_number();
+  if (all || test == 12) test2_idmap_get_number();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_idmap_create() {
+  IdMap *m;
+  m = idmap_create();
+  PRINT_TEST_RESULT(m != NULL && idmap_get_number(m) == 0);
+  idmap_destroy(m);
+}
+
+void test1_idmap_destroy() {
+  IdMap *m;
+  m = idmap_create();
+  PRINT_TEST_RESULT(idmap_destroy(m) == OK);
+}
+
+void test2_idmap_destroy() {
+  IdMap *m = NULL;
+  PRINT_TEST_RESULT(idmap_destroy(m) == ERROR);
+}
+
+void test1_idmap_put() {
+  IdMap *m;
+  m = idmap_create();
+  PRINT_TEST_RESULT(idmap_put(m, 1101, 0) == OK && idmap_get(m, 1101) == 0);
+  idmap_destroy(m);
+}
+
+void test2_idmap_put() {
+  IdMap *m;
+  m = idmap_create();
+  idmap_put(m, 1101, 0);
+  idmap_put(m, 1101, 7);
+  PRINT_TEST_RESULT(idmap_get(m, 1101) == 7 && idmap_get_number(m) == 1);
+  idmap_destroy(m);
+}
+
+void test3_idmap_put() {
+  IdMap *m;
+  m = idmap_create();
+  PRINT_TEST_RESULT(idmap_put(m, 1101, -1) == ERROR);
+  idmap_destroy(m);
+}
+
+void test1_idmap_get() {
+  IdMap *m;
+  int i, ok = 1;
+  m = idmap_create();
+  for (i = 0; i < 10000; i++) {
+    idmap_put(m, 1000 + 3 * i, i);
+  }
+  for (i = 0; i < 10000; i++) {
+    ok = ok && idmap_get(m, 1000 + 3 * i) == i && idmap_get(m, 1001 + 3 * i) == -1;
+  }
+  PRINT_TEST_RESULT(ok);
+  idmap_destroy(m);
+}
+
+void test2_idmap_get() {
+  IdMap *m = NULL;
+  PRINT_TEST_RESULT(idmap_get(m, 1101) == -1);
+}
+
+void test1_idmap_remove() {
+  IdMap *m;
+  int i, ok = 1;
+  m = idmap_create();
+  for (i = 0; i < 1000; i++) {
+    idmap_put(m, i, i);
+  }
+  for (i = 0; i < 1000; i += 2) {
+    idmap_remove(m, i);
+  }
+  for (i = 0; i < 1000; i++) {
+    ok = ok && idmap_get(m, i) == ((i % 2) ? i : -1);
+  }
+  PRINT_TEST_RESULT(ok && idmap_get_number(m) == 500);
+  idmap_destroy(m);
+}
+
+void test2_idmap_remove() {
+  IdMap *m;
+  m = idmap_create();
+  idmap_put(m, 1101, 0);
+  PRINT_TEST_RESULT(idmap_remove(m, 1102) == ERROR);
+  idmap_destroy(m);
+}
+
+void test1_idmap_get_number() {
+  IdMap *m;
+  m = idmap_create();
+  idmap_put(m, 1101, 0);
+  idmap_put(m, 1102, 1);
+  PRINT_TEST_RESULT(idmap_get_number(m) == 2);
+  idmap_destroy(m);
+}
+
+void test2_idmap_get_number() {
+  IdMap *m = NULL;
+  PRINT_TEST_RESULT(idmap_get_number(m) == -1);
+}
@@ -7,33 +7,131 @@
 */
 
 
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include "inventory.h"
 
 #define MAX_OBJS 4
+#define WORD_BITS 64
 
 
 struct _Inventory
 {
-   Set* objs;
+   Set* objs;          /*Objects, in the order they were added*/
    int max_objs;
+   Arena *arena;
+   IdMap *index;       /*Map from the ids of the objects to their positions, NULL if there is no bitset*/
+   uint64_t *bits;     /*Bit i set if the object in position i is in the inventory*/
+   int n_words;        /*Words of the bitset*/
 };
 
 
+/*----------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Gives the position of an object in the bitset, -1 if it has none
+ */
+static int inventory_bit(Inventory *inv, Id id){
+   int i;
+
+   if((i = idmap_get(inv->index, id)) < 0 || i >= inv->n_words * WORD_BITS)
+      return -1;
+
+   return i;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Makes the bitset long enough for the position i
+ */
+static STATUS inventory_grow(Inventory *inv, int i){
+   uint64_t *aux;
+   int n_words = i / WORD_BITS + 1;
+
+   if(n_words <= inv->n_words)
+      return OK;
+
+   if((aux = (uint64_t*) arena_realloc(inv->arena, inv->bits, inv->n_words * sizeof(uint64_t), n_words * sizeof(uint64_t))) == NULL)
+      return ERROR;
+   memset(aux + inv->n_words, 0, (n_words - inv->n_words) * sizeof(uint64_t));
+   inv->bits = aux;
+   inv->n_words = n_words;
+
+   return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Gives the number of objects, counting the bits of the bitset if there is one
+ */
+static int inventory_count(Inventory *inv){
+   int i, n = 0;
+
+   if(!inv->index)
+      return set_get_numberofIds(inv->objs);
+
+   for(i = 0; i < inv->n_words; i++)
+      n += __builtin_popcountll(inv->bits[i]);
+
+   return n;
+}
+
+
 /*----------------------------------------------------------------------------------------------------*/
 Inventory *inventory_create(){
+   return inventory_create_in(NULL);
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+Inventory *inventory_create_in(Arena *arena){
    Inventory *inv_new;
 
-   inv_new = (Inventory*) malloc(sizeof(Inventory));
+   inv_new = (Inventory*) arena_alloc(arena, sizeof(Inventory));
    if(!inv_new)
       return NULL;
    
-   inv_new->objs = set_create(inv_new->objs);
+   inv_new->objs = set_create_in(arena);
    inv_new->max_objs = MAX_OBJS;
+   inv_new->arena = arena;
+   inv_new->index = NULL;
+   inv_new->bits = NULL;
+   inv_new->n_words = 0;
 
    return inv_new;
 }
 
+/*----------------------------------------------------------------------------------------------------*/
+Inventory *inventory_copy_in(Arena *arena, Inventory *inv){
+   Inventory *copy;
+
+   if(!inv)
+      return NULL;
+
+   copy = (Inventory*) arena_alloc(arena, sizeof(Inventory));
+   if(!copy)
+      return NULL;
+
+   if((copy->objs = set_copy_in(arena, inv->objs)) == NULL){
+      arena_free(arena, copy, sizeof(Inventory));
+      return NULL;
+   }
+   copy->max_objs = inv->max_objs;
+   copy->arena = arena;
+   copy->index = inv->index;
+   copy->bits = NULL;
+   copy->n_words = 0;
+   if(inv->n_words > 0){
+      if((copy->bits = (uint64_t*) arena_alloc(arena, inv->n_words * sizeof(uint64_t))) == NULL){
+         inventory_destroy(copy);
+         return NULL;
+      }
+      memcpy(copy->bits, inv->bits, inv->n_words * sizeof(uint64_t));
+      copy->n_words = inv->n_words;
+   }
+
+   return copy;
+}
+
 /*----------------------------------------------------------------------------------------------------*/
 STATUS inventory_destroy(Inventory* inv){
    /*Error control*/
@@ -41,7 +139,8 @@ STATUS inventory_destroy(Inventory* inv){
       return ERROR;
    
    set_destroy(inv->objs);
-   free(inv);
+   arena_free(inv->arena, inv->bits, inv->n_words * sizeof(uint64_t));
+   arena_free(inv->arena, inv, sizeof(Inventory));
 
    return OK;
 }
@@ -54,10 +153,7 @@ BOOL inventory_isFull(Inventory* inv){
    if(!inv)
       return FALSE;
    
-   if(set_get_numberofIds(inv->objs) == NO_ID)
-      return FALSE;
-   else
-      n_ids = set_get_numberofIds(inv->objs);
+   n_ids = inventory_count(inv);
    
    if(inv->max_objs <= n_ids)
       return TRUE;
@@ -71,7 +167,7 @@ BOOL inventory_isEmpty(Inventory* inv){
    if(!inv)
       return FALSE;
    
-   if(set_get_numberofIds(inv->objs) == 0)
+   if(inventory_count(inv) == 0)
       return TRUE;
    
    return FALSE;
@@ -79,21 +175,32 @@ BOOL inventory_isEmpty(Inventory* inv){
 
 /*----------------------------------------------------------------------------------------------------*/
 STATUS inventory_add(Inventory* inv, Id id){
+   int i = -1;
+
    /*Error control*/
    if(!inv || id == NO_ID)
       return ERROR;
 
    if(inventory_isFull(inv) == TRUE)
       return ERROR;
+
+   /*With a bitset, only objects of its map can be added*/
+   if(inv->index && ((i = idmap_get(inv->index, id)) < 0 || inventory_grow(inv, i) == ERROR))
+      return ERROR;
    
    if(set_add(inv->objs, id) == ERROR)
       return ERROR;
+
+   if(i >= 0)
+      inv->bits[i / WORD_BITS] |= (uint64_t)1 << (i % WORD_BITS);
    
    return OK;
 }
 
 /*----------------------------------------------------------------------------------------------------*/
 STATUS inventory_del(Inventory* inv, Id id){
+   int i;
+
    /*Error control*/
    if(!inv || id == NO_ID)
       return ERROR;
@@ -103,6 +210,9 @@ STATUS inventory_del(Inventory* inv, Id id){
    
    if(set_del(inv->objs, id) == ERROR)
       return ERROR;
+
+   if(inv->index && (i = inventory_bit(inv, id)) >= 0)
+      inv->bits[i / WORD_BITS] &= ~((uint64_t)1 << (i % WORD_BITS));
    
    return OK;
 }
@@ -152,9 +262,16 @@ STATUS inventory_setMaxObjs(Inventory *inv, int value){
 
 /*----------------------------------------------------------------------------------------------------*/
 BOOL inventory_contains(Inventory *inv, Id id){
+   int i;
+
    /*Error control*/
    if(!inv || id == NO_ID)
       return FALSE;
+
+   if(inv->index){
+      i = inventory_bit(inv, id);
+      return (i >= 0 && (inv->bits[i / WORD_BITS] >> (i % WORD_BITS) & 1)) ? TRUE : FALSE;
+   }
    
    if(set_contains(inv->objs, id) == TRUE)
       return TRUE;
@@ -171,6 +288,31 @@ STATUS inventory_setCapacity(Inventory *inv, int capacity){
    return OK;
 }
 
+/*----------------------------------------------------------------------------------------------------*/
+STATUS inventory_setIndex(Inventory *inv, IdMap *index){
+   Id *ids;
+   int i, k, n;
+
+   if(!inv || !index || inv->index)
+      return ERROR;
+
+   /*Every object it already has needs a position, else it is left as it was*/
+   ids = set_get_ids(inv->objs);
+   n = set_get_numberofIds(inv->objs);
+   for(k = 0; k < n; k++){
+      if((i = idmap_get(index, ids[k])) < 0 || inventory_grow(inv, i) == ERROR){
+         arena_free(inv->arena, inv->bits, inv->n_words * sizeof(uint64_t));
+         inv->bits = NULL;
+         inv->n_words = 0;
+         return ERROR;
+      }
+      inv->bits[i / WORD_BITS] |= (uint64_t)1 << (i % WORD_BITS);
+   }
+   inv->index = index;
+
+   return OK;
+}
+
 /*----------------------------------------------------------------------------------------------------*/
 Set* inventory_getSet(Inventory *inv){
    if(!inv)
@@ -60,6 +60,8 @@ int main(int argc, char** argv) {
   if (all || test == 24) test1_inv_setMaxObjs();
   if (all || test == 25) test2_inv_setMaxObjs();
   if (all || test == 26) test3_inv_setMaxObjs();
+  if (all || test == 27) test1_inv_setIndex();
+  if (all || test == 28) test2_inv_setIndex();
 
   
   PRINT_PASSED_PERCENTAGE;
@@ -237,4 +239,38 @@ void test3_inv_setMaxObjs() {
   inv = inventory_create();
   PRINT_TEST_RESULT(inventory_setMaxObjs(inv, NO_ID) == ERROR);
   inventory_destroy(inv);
-}
\ No newline at end of file
+}
+void test1_inv_setIndex() {
+  Inventory *inv, *copy;
+  IdMap *map;
+  int i;
+  map = idmap_create();
+  for (i = 0; i < 100; i++)
+    idmap_put(map, 1000 + i, i);
+  inv = inventory_create();
+  inventory_setCapacity(inv, 3);
+  inventory_add(inv, 1001);
+  inventory_setIndex(inv, map);
+  inventory_add(inv, 1099);
+  copy = inventory_copy_in(NULL, inv);
+  inventory_del(inv, 1001);
+  PRINT_TEST_RESULT(inventory_contains(inv, 1099) == TRUE && inventory_contains(inv, 1001) == FALSE &&
+                    inventory_add(inv, 7) == ERROR && inventory_contains(copy, 1001) == TRUE &&
+                    inventory_add(copy, 1050) == OK && inventory_isFull(copy) == TRUE);
+  inventory_destroy(inv);
+  inventory_destroy(copy);
+  idmap_destroy(map);
+}
+
+void test2_inv_setIndex() {
+  Inventory *inv;
+  IdMap *map;
+  map = idmap_create();
+  idmap_put(map, 1, 0);
+  inv = inventory_create();
+  inventory_add(inv, 2);
+  PRINT_TEST_RESULT(inventory_setIndex(inv, map) == ERROR && inventory_contains(inv, 2) == TRUE &&
+                    inventory_add(inv, 3) == OK);
+  inventory_destroy(inv);
+  idmap_destroy(map);
+}
@@ -0,0 +1,754 @@
+/**
+ * @brief It implements the level streaming of a world
+ *
+ * The data file stays mapped while the game runs. Creating the levels only
+ * finds where the records of each level are in the file; a level is parsed
+ * into a W_World the first time it is needed or prefetched, and its entities
+ * are made from those records every time it is loaded.
+ *
+ * When the file is saved again it is mapped again and split once more, and
+ * the levels already parsed are parsed again from it. A link keeps the state
+ * the game left it in unless its record changed, as the watcher does with
+ * the links that are in the game.
+ *
+ * @file levels.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "levels.h"
+#include "world.h"
+
+#define LEVELS_CHUNK 16
+
+/**
+ * @brief Part of the data file, a run of records of the same level
+ */
+typedef struct {
+  long start; /*!< Position of its first record */
+  long size;  /*!< Number of characters, without the last end of line */
+} L_Range;
+
+/**
+ * @brief A level of the world
+ */
+typedef struct {
+  long number;       /*!< Id of its spaces divided by LEVEL_ROOMS */
+  L_Range *ranges;   /*!< Where its records are in the data file */
+  int n_ranges;      /*!< Number of ranges */
+  int max_ranges;    /*!< Allocated size of ranges */
+  long *adjacent;    /*!< Numbers of the levels its links lead to or come from */
+  int n_adjacent;    /*!< Number of adjacent levels */
+  int max_adjacent;  /*!< Allocated size of adjacent */
+  W_World *world;    /*!< Its records, NULL until it is parsed */
+  W_Link *links;     /*!< Its link records as the file gives them, those of world keep the state of the game */
+  int *arts;         /*!< Art of each space record in the store of the game, -1 until it is first loaded */
+  W_Fixups parked;   /*!< Objects left in its spaces while it is not loaded */
+  BOOL loaded;       /*!< If its spaces and links are in the game */
+  BOOL pending;      /*!< If it is being parsed by the background thread */
+} Level;
+
+struct _Levels {
+  char *path;           /*!< Name of the data file */
+  char *data;           /*!< Mapped data file */
+  size_t size;          /*!< Size of the data file */
+  Level base;           /*!< Records of the objects, players and enemies */
+  Level *levels;        /*!< Every level, sorted by number */
+  int n_levels;         /*!< Number of levels */
+  int max_levels;       /*!< Allocated size of levels */
+  int current;          /*!< Index of the level the player is on, -1 before the start */
+  int *jobs;            /*!< Indices of the levels given to the background thread */
+  int n_jobs;           /*!< Number of jobs */
+  pthread_t thread;     /*!< Background thread */
+  BOOL running;         /*!< If the thread was started and not joined */
+  BOOL done;            /*!< If the thread finished its jobs */
+  pthread_mutex_t lock; /*!< Protects done */
+};
+
+/*--------------------------------------------------------------------------------------------------------*/
+static void *levels_grow(void *array, int n, int *max, size_t size) {
+  void *aux = NULL;
+
+  if (n < *max)
+    return array;
+
+  aux = realloc(array, (*max + LEVELS_CHUNK + *max / 2) * size);
+  if (!aux)
+    return NULL;
+  *max += LEVELS_CHUNK + *max / 2;
+
+  return aux;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Gives a field of a record as a number, counting from the one after the tag and skipping
+ * empty fields like the loaders
+ */
+static long levels_field(const char *p, const char *eol, int n) {
+  int field = 0;
+
+  while (p < eol) {
+    while (p < eol && *p == '|')
+      p++;
+    if (p == eol)
+      break;
+    if (field++ == n)
+      return atol(p);
+    while (p < eol && *p != '|')
+      p++;
+  }
+
+  return 0;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Finds a level by its number
+ * @return its index or -1
+ */
+static int levels_find(const Levels *levels, long number) {
+  int lo = 0, hi = levels->n_levels, mid;
+
+  while (lo < hi) {
+    mid = (lo + hi) / 2;
+    if (levels->levels[mid].number < number)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return (lo < levels->n_levels && levels->levels[lo].number == number) ? lo : -1;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Finds a level by its number, adding it if it is not there yet
+ * @return its index or -1
+ */
+static int levels_get(Levels *levels, long number) {
+  Level *aux = NULL;
+  int i;
+
+  if ((i = levels_find(levels, number)) >= 0)
+    return i;
+
+  if ((aux = levels_grow(levels->levels, levels->n_levels, &levels->max_levels, sizeof(Level))) == NULL)
+    return -1;
+  levels->levels = aux;
+
+  for (i = levels->n_levels; i > 0 && levels->levels[i - 1].number > number; i--)
+    levels->levels[i] = levels->levels[i - 1];
+
+  memset(&levels->levels[i], 0, sizeof(Level));
+  levels->levels[i].number = number;
+  levels->n_levels++;
+
+  return i;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a record to the ranges of a level, joining it to the last range if it comes right after it
+ */
+static STATUS levels_range(Level *level, long start, long size) {
+  L_Range *aux = NULL, *last = NULL;
+
+  last = level->n_ranges ? &level->ranges[level->n_ranges - 1] : NULL;
+  if (last && last->start + last->size + 1 == start) {
+    last->size = start + size - last->start;
+    return OK;
+  }
+
+  if ((aux = levels_grow(level->ranges, level->n_ranges, &level->max_ranges, sizeof(L_Range))) == NULL)
+    return ERROR;
+  level->ranges = aux;
+  level->ranges[level->n_ranges].start = start;
+  level->ranges[level->n_ranges].size = size;
+  level->n_ranges++;
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+static STATUS levels_adjacent(Level *level, long number) {
+  long *aux = NULL;
+  int i;
+
+  for (i = 0; i < level->n_adjacent; i++) {
+    if (level->adjacent[i] == number)
+      return OK;
+  }
+
+  if ((aux = levels_grow(level->adjacent, level->n_adjacent, &level->max_adjacent, sizeof(long))) == NULL)
+    return ERROR;
+  level->adjacent = aux;
+  level->adjacent[level->n_adjacent++] = number;
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Splits the data file in ranges of records of each level, and finds which levels are adjacent
+ */
+static STATUS levels_scan(Levels *levels) {
+  const char *data = levels->data, *p = data, *end = data + levels->size, *eol, *start;
+  long origin, destination;
+  int a, b, i, nlines;
+
+  while (p < end) {
+    if (!(eol = memchr(p, '\n', end - p)))
+      eol = end;
+
+    if (eol - p < 3 || p[0] != '#' || p[2] != ':' || !strchr("soepl", p[1])) {
+      p = eol + 1;
+      continue;
+    }
+
+    start = p;
+    if (p[1] == 's') {
+      nlines = levels_field(p + 3, eol, 2);
+      for (i = 0; i < nlines && eol < end; i++) {
+        p = eol + 1;
+        if (!(eol = memchr(p, '\n', end - p)))
+          eol = end;
+      }
+    }
+
+    switch (start[1]) {
+      case 's':
+        if ((a = levels_get(levels, levels_field(start + 3, eol, 0) / LEVEL_ROOMS)) < 0 ||
+            levels_range(&levels->levels[a], start - data, eol - start) == ERROR)
+          return ERROR;
+        break;
+      case 'l':
+        origin = levels_field(start + 3, eol, 2);
+        destination = levels_field(start + 3, eol, 3);
+        if ((a = levels_get(levels, origin / LEVEL_ROOMS)) < 0 ||
+            levels_range(&levels->levels[a], start - data, eol - start) == ERROR)
+          return ERROR;
+        if (destination != NO_ID && destination / LEVEL_ROOMS != origin / LEVEL_ROOMS) {
+          if ((b = levels_get(levels, destination / LEVEL_ROOMS)) < 0)
+            return ERROR;
+          a = levels_find(levels, origin / LEVEL_ROOMS);
+          if (levels_adjacent(&levels->levels[a], levels->levels[b].number) == ERROR ||
+              levels_adjacent(&levels->levels[b], levels->levels[a].number) == ERROR)
+            return ERROR;
+        }
+        break;
+      default:
+        if (levels_range(&levels->base, start - data, eol - start) == ERROR)
+          return ERROR;
+        break;
+    }
+
+    p = eol + 1;
+  }
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Parses the records of a level. It is called by the background thread too, so it only
+ * touches the level
+ */
+static STATUS levels_parse(Level *level, const char *data) {
+  W_World *w = NULL;
+  int i, r, before;
+
+  if ((w = world_create()) == NULL)
+    return ERROR;
+
+  for (r = 0; r < level->n_ranges; r++) {
+    before = w->n_spaces;
+    if (world_parse(w, data + level->ranges[r].start, level->ranges[r].size) == ERROR) {
+      world_destroy(w);
+      return ERROR;
+    }
+    /* The art was found relative to the range */
+    for (i = before; i < w->n_spaces; i++) {
+      if (w->spaces[i].offset >= 0)
+        w->spaces[i].offset += level->ranges[r].start;
+    }
+  }
+
+  if ((level->arts = (int *)malloc((w->n_spaces + 1) * sizeof(int))) == NULL ||
+      (level->links = (W_Link *)malloc((w->n_links + 1) * sizeof(W_Link))) == NULL) {
+    free(level->arts);
+    level->arts = NULL;
+    world_destroy(w);
+    return ERROR;
+  }
+  for (i = 0; i < w->n_spaces; i++)
+    level->arts[i] = -1;
+  memcpy(level->links, w->links, w->n_links * sizeof(W_Link));
+
+  level->world = w;
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+static void *levels_worker(void *arg) {
+  Levels *levels = (Levels *)arg;
+  int i;
+
+  for (i = 0; i < levels->n_jobs; i++)
+    levels_parse(&levels->levels[levels->jobs[i]], levels->data);
+
+  pthread_mutex_lock(&levels->lock);
+  levels->done = TRUE;
+  pthread_mutex_unlock(&levels->lock);
+
+  return NULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Joins the background thread if it already finished
+ */
+static void levels_reap(Levels *levels) {
+  BOOL done;
+
+  if (!levels->running)
+    return;
+
+  pthread_mutex_lock(&levels->lock);
+  done = levels->done;
+  pthread_mutex_unlock(&levels->lock);
+
+  if (done)
+    levels_wait(levels);
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Queues a level for the background thread if it was not parsed
+ */
+static void levels_queue(Levels *levels, int i) {
+  if (i < 0 || levels->levels[i].pending || levels->levels[i].world)
+    return;
+
+  levels->levels[i].pending = TRUE;
+  levels->jobs[levels->n_jobs++] = i;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Starts parsing in the background the levels around those the exits of the player's space
+ * lead to, if they lead out of the current level
+ */
+static void levels_prefetch(Levels *levels, Game *game) {
+  Space *space = NULL;
+  Level *next = NULL;
+  Id destination;
+  int d, i, n;
+
+  levels_reap(levels);
+  if (levels->running)
+    return;
+
+  if ((space = game_get_space(game, player_getLocation(game->play))) == NULL)
+    return;
+
+  for (d = N; d <= W; d++) {
+    destination = link_getDestination(space_get_link(space, d));
+    if (destination == NO_ID || (n = levels_find(levels, destination / LEVEL_ROOMS)) < 0 || n == levels->current)
+      continue;
+
+    next = &levels->levels[n];
+    for (i = 0; i < next->n_adjacent; i++)
+      levels_queue(levels, levels_find(levels, next->adjacent[i]));
+  }
+
+  if (levels->n_jobs == 0)
+    return;
+
+  levels->done = FALSE;
+  if (pthread_create(&levels->thread, NULL, levels_worker, levels) != 0) {
+    /* They will be parsed when they are needed */
+    for (i = 0; i < levels->n_jobs; i++)
+      levels->levels[levels->jobs[i]].pending = FALSE;
+    levels->n_jobs = 0;
+    return;
+  }
+  levels->running = TRUE;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds the spaces and links of a level to the game and places the objects left in it
+ */
+static STATUS levels_load(Levels *levels, Game *game, int n) {
+  Level *level = NULL;
+  W_Fixups attached = {NULL, 0, 0};
+  const W_Space *rec = NULL;
+  Space *space = NULL;
+  STATUS status = OK;
+  int i;
+
+  if (n < 0 || (level = &levels->levels[n])->loaded)
+    return OK;
+
+  if (level->pending)
+    levels_wait(levels);
+  if (!level->world && levels_parse(level, levels->data) == ERROR)
+    return ERROR;
+
+  for (i = 0; status == OK && i < level->world->n_spaces; i++) {
+    rec = &level->world->spaces[i];
+    if ((space = world_new_space(game, rec)) == NULL)
+      continue;
+
+    /* The art is recorded in the store only once, however many times the level is loaded */
+    if (level->arts[i] < 0 && game->art && !rec->gdesc && rec->offset >= 0)
+      level->arts[i] = art_add(game->art, rec->offset, rec->nlines);
+    if (level->arts[i] >= 0)
+      space_set_art(space, game->art, level->arts[i]);
+
+    if (game_add_space(game, space) == ERROR) {
+      space_destroy(space);
+      status = ERROR;
+    }
+  }
+
+  for (i = 0; status == OK && i < level->world->n_links; i++) {
+    status = world_add_link(game, &level->world->links[i], &attached);
+  }
+
+  world_fixup(game, &level->parked, &attached);
+  free(attached.items);
+  level->loaded = TRUE;
+
+  return status;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes the spaces and links of a level from the game, keeping the state of its links and
+ * the objects that are in its spaces
+ */
+static STATUS levels_unload(Levels *levels, Game *game, int n) {
+  Level *level = &levels->levels[n];
+  W_Link *rec = NULL;
+  Space *space = NULL;
+  Link *link = NULL;
+  Id *ids = NULL;
+  int i, k;
+
+  if (!level->loaded)
+    return OK;
+
+  for (i = 0; i < level->world->n_links; i++) {
+    rec = &level->world->links[i];
+    if ((link = game_get_link(game, rec->id)) == NULL)
+      continue;
+    rec->open = link_getOpen(link);
+    game_remove_link(game, rec->id);
+  }
+
+  for (i = 0; i < level->world->n_spaces; i++) {
+    if ((space = game_get_space(game, level->world->spaces[i].id)) == NULL)
+      continue;
+
+    ids = space_get_objects(space);
+    for (k = 0; ids && k < set_get_numberofIds(space_get_set(space)); k++) {
+      if (world_queue(&level->parked, ids[k], level->world->spaces[i].id, Unkown) == ERROR)
+        return ERROR;
+    }
+    game_remove_space(game, level->world->spaces[i].id);
+  }
+
+  level->loaded = FALSE;
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+static void levels_free(Level *level) {
+  world_destroy(level->world);
+  free(level->ranges);
+  free(level->adjacent);
+  free(level->links);
+  free(level->arts);
+  free(level->parked.items);
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Maps the data file
+ * @return OK, or ERROR leaving data and size as they were
+ */
+static STATUS levels_map(const char *path, char **data, size_t *size) {
+  struct stat st;
+  char *aux = NULL;
+  int fd;
+
+  if ((fd = open(path, O_RDONLY)) < 0 || fstat(fd, &st) < 0) {
+    if (fd >= 0)
+      close(fd);
+    return ERROR;
+  }
+
+  if (st.st_size > 0 && (aux = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED) {
+    close(fd);
+    return ERROR;
+  }
+  close(fd);
+
+  *data = aux;
+  *size = st.st_size;
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Parses a level again from the data file, keeping the art of its spaces and the state of the
+ * links whose records did not change
+ */
+static STATUS levels_reparse(Level *level, const char *data, Game *game) {
+  W_World *old = level->world;
+  W_Link *links = level->links, *rec = NULL;
+  int *arts = level->arts;
+  int i, k;
+
+  level->world = NULL;
+  level->links = NULL;
+  level->arts = NULL;
+  if (levels_parse(level, data) == ERROR) {
+    level->world = old;
+    level->links = links;
+    level->arts = arts;
+    return ERROR;
+  }
+
+  /* The art is moved to where its lines are now */
+  for (i = 0; i < level->world->n_spaces; i++) {
+    for (k = 0; k < old->n_spaces && old->spaces[k].id != level->world->spaces[i].id; k++)
+      ;
+    if (k < old->n_spaces && (level->arts[i] = arts[k]) >= 0 && game->art)
+      art_set(game->art, level->arts[i], level->world->spaces[i].offset, level->world->spaces[i].nlines);
+  }
+
+  for (i = 0; i < level->world->n_links; i++) {
+    rec = &level->world->links[i];
+    for (k = 0; k < old->n_links && links[k].id != rec->id; k++)
+      ;
+    if (k < old->n_links && links[k].origin == rec->origin && links[k].destination == rec->destination &&
+        links[k].dir == rec->dir && links[k].open == rec->open && links[k].requirement == rec->requirement &&
+        strcmp(links[k].name, rec->name) == 0)
+      rec->open = old->links[k].open;
+  }
+
+  world_destroy(old);
+  free(links);
+  free(arts);
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+Levels *levels_create(const char *filename) {
+  Levels *levels = NULL;
+
+  if (!filename)
+    return NULL;
+
+  if ((levels = (Levels *)calloc(1, sizeof(Levels))) == NULL)
+    return NULL;
+  levels->current = -1;
+  pthread_mutex_init(&levels->lock, NULL);
+
+  if ((levels->path = strdup(filename)) == NULL || levels_map(filename, &levels->data, &levels->size) == ERROR ||
+      levels_scan(levels) == ERROR ||
+      (levels->jobs = (int *)malloc((levels->n_levels + 1) * sizeof(int))) == NULL) {
+    levels_destroy(levels);
+    return NULL;
+  }
+
+  return levels;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS levels_destroy(Levels *levels) {
+  int i;
+
+  if (!levels)
+    return ERROR;
+
+  levels_wait(levels);
+  for (i = 0; i < levels->n_levels; i++)
+    levels_free(&levels->levels[i]);
+  levels_free(&levels->base);
+  free(levels->levels);
+  free(levels->jobs);
+  if (levels->data)
+    munmap(levels->data, levels->size);
+  free(levels->path);
+  pthread_mutex_destroy(&levels->lock);
+  free(levels);
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS levels_start(Levels *levels, Game *game) {
+  W_Fixups placed = {NULL, 0, 0};
+  W_World *w = NULL;
+  STATUS status = OK;
+  int i, n;
+
+  if (!levels || !game)
+    return ERROR;
+
+  if (!levels->base.world && levels_parse(&levels->base, levels->data) == ERROR)
+    return ERROR;
+  w = levels->base.world;
+
+  for (i = 0; status == OK && i < w->n_objects; i++) {
+    status = world_add_object(game, &w->objects[i], &placed);
+  }
+  for (i = 0; status == OK && i < w->n_players; i++) {
+    status = world_add_player(game, &w->players[i]);
+  }
+  for (i = 0; status == OK && i < w->n_enemies; i++) {
+    status = world_add_enemy(game, &w->enemies[i]);
+  }
+
+  /* Every object waits in its level until the level is loaded */
+  for (i = 0; status == OK && i < placed.n; i++) {
+    if ((n = levels_find(levels, placed.items[i].space / LEVEL_ROOMS)) >= 0)
+      status = world_queue(&levels->levels[n].parked, placed.items[i].id, placed.items[i].space, Unkown);
+  }
+  free(placed.items);
+
+  world_destroy(levels->base.world);
+  levels->base.world = NULL;
+
+  if (status == ERROR)
+    return ERROR;
+
+  return levels_update(levels, game);
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS levels_update(Levels *levels, Game *game) {
+  Level *level = NULL;
+  STATUS status = OK;
+  BOOL keep;
+  int n, i, k;
+
+  if (!levels || !game || !game->play)
+    return ERROR;
+
+  n = levels_find(levels, player_getLocation(game->play) / LEVEL_ROOMS);
+  if (player_getLocation(game->play) != NO_ID && n >= 0 && n != levels->current) {
+    level = &levels->levels[n];
+
+    /* Unload first, so the spaces of the new levels fit in the game */
+    for (i = 0; i < levels->n_levels; i++) {
+      keep = (i == n);
+      for (k = 0; !keep && k < level->n_adjacent; k++)
+        keep = (levels->levels[i].number == level->adjacent[k]);
+      if (!keep && levels_unload(levels, game, i) == ERROR)
+        status = ERROR;
+    }
+
+    if (levels_load(levels, game, n) == ERROR)
+      status = ERROR;
+    for (k = 0; k < level->n_adjacent; k++) {
+      if (levels_load(levels, game, levels_find(levels, level->adjacent[k])) == ERROR)
+        status = ERROR;
+    }
+
+    levels->current = n;
+    game_resolve_links(game);
+  }
+
+  levels_prefetch(levels, game);
+
+  return status;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS levels_reload(Levels *levels, Game *game) {
+  char *data = NULL;
+  size_t size = 0;
+  long current;
+  int *aux = NULL;
+  int i;
+
+  if (!levels || !game)
+    return ERROR;
+
+  /* The background thread reads the old file */
+  levels_wait(levels);
+  if (levels_map(levels->path, &data, &size) == ERROR)
+    return ERROR;
+  if (levels->data)
+    munmap(levels->data, levels->size);
+  levels->data = data;
+  levels->size = size;
+
+  /* New levels are put in order among the others, the current one is found again by its number */
+  current = (levels->current >= 0) ? levels->levels[levels->current].number : -1;
+  levels->base.n_ranges = 0;
+  for (i = 0; i < levels->n_levels; i++)
+    levels->levels[i].n_ranges = levels->levels[i].n_adjacent = 0;
+  if (levels_scan(levels) == ERROR)
+    return ERROR;
+  if (current >= 0)
+    levels->current = levels_find(levels, current);
+
+  if ((aux = (int *)realloc(levels->jobs, (levels->n_levels + 1) * sizeof(int))) == NULL)
+    return ERROR;
+  levels->jobs = aux;
+
+  for (i = 0; i < levels->n_levels; i++) {
+    if (levels->levels[i].world && levels_reparse(&levels->levels[i], levels->data, game) == ERROR)
+      return ERROR;
+  }
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+BOOL levels_is_loaded(Levels *levels, long level) {
+  int n;
+
+  if (!levels || (n = levels_find(levels, level)) < 0)
+    return FALSE;
+
+  return levels->levels[n].loaded;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS levels_wait(Levels *levels) {
+  int i;
+
+  if (!levels)
+    return ERROR;
+
+  if (levels->running) {
+    pthread_join(levels->thread, NULL);
+    levels->running = FALSE;
+  }
+
+  for (i = 0; i < levels->n_jobs; i++)
+    levels->levels[levels->jobs[i]].pending = FALSE;
+  levels->n_jobs = 0;
+
+  return OK;
+}
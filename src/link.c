@@ -19,41 +19,67 @@
  */
 struct _Link {
   Id id;                    /*!< Id number of the link, it must be unique */
-  char name[WORD_SIZE + 1]; /*!< Name of the link */
+  StrId name;               /*!< Name of the link, in the table of the program */
   Id origin;                /*!< Id of the origin space */
   Id destination;           /*!< Id of the destination space */
   DIRECTION direction;         /*!< Direction of the link */
   Id requirement;           /*!< Id of the object or enemy required to open the link */
   BOOL open;                /*!< Open or closed */
+  Arena *arena;             /*!< Arena the link comes from, NULL if it is in the heap */
 };
 
 /*--------------------------------------------------------------------------------------------------------*/
 Link *link_create() {
+  return link_create_in(NULL);
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+Link *link_create_in(Arena *arena) {
 
   Link *newLink = NULL;
 
-  newLink = (Link *)malloc(sizeof(Link));
+  newLink = (Link *)arena_alloc(arena, sizeof(Link));
 
   if (!newLink)
     return NULL;
 
   newLink->id = NO_ID;
-  newLink->name[0] = '\0';
+  newLink->name = NO_STR;
   newLink->origin = NO_ID;
   newLink->destination = NO_ID;
   newLink->direction = Unkown;
   newLink->open = FALSE;
   newLink->requirement = NO_ID;
+  newLink->arena = arena;
 
   return newLink;
 }
 
+/*--------------------------------------------------------------------------------------------------------*/
+Link *link_copy_in(Arena *arena, Link *link) {
+
+  Link *copy = NULL;
+
+  if (!link)
+    return NULL;
+
+  copy = (Link *)arena_alloc(arena, sizeof(Link));
+
+  if (!copy)
+    return NULL;
+
+  *copy = *link;
+  copy->arena = arena;
+
+  return copy;
+}
+
 /*--------------------------------------------------------------------------------------------------------*/
 STATUS link_destroy(Link *link) {
   if (!link)
     return ERROR;
 
-  free(link);
+  arena_free(link->arena, link, sizeof(Link));
   link = NULL;
 
   return OK;
@@ -71,12 +97,15 @@ STATUS link_setId(Link *link, Id id) {
 
 /*--------------------------------------------------------------------------------------------------------*/
 STATUS link_setName(Link *link, char *name) {
+  StrId id;
+
   if (!link || !name)
     return ERROR;
 
-  if (!strcpy(link->name, name))
+  if ((id = strtab_id(name)) == NO_STR && name[0])
     return ERROR;
 
+  link->name = id;
   return OK;
 }
 
@@ -138,6 +167,14 @@ const char *link_getName(Link *link) {
   if (!link)
     return NULL;
 
+  return strtab_str(link->name);
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+StrId link_getNameId(Link *link) {
+  if (!link)
+    return NO_STR;
+
   return link->name;
 }
 
@@ -186,7 +223,7 @@ STATUS link_print(Link *link) {
     if (!link)
         return ERROR;
     
-    if(fprintf(stdout, "--> Link (Id: %ld; Name: %s; Origin: %ld; Destination: %ld; Open: %d)" , link->id, link->name, link->origin, link->destination, link->open) < 0)
+    if(fprintf(stdout, "--> Link (Id: %ld; Name: %s; Origin: %ld; Destination: %ld; Open: %d)" , link->id, strtab_str(link->name), link->origin, link->destination, link->open) < 0)
         return ERROR;
 
     return OK;
@@ -15,7 +15,7 @@
 #include "link_test.h"
 #include "test.h"
 
-#define MAX_TESTS 38
+#define MAX_TESTS 39
 
 /** 
  * @brief Main function for SPACE unit tests. 
@@ -81,6 +81,7 @@ int main(int argc, char** argv) {
     if (all || test == 36) test1_link_set_direction();
     if (all || test == 37) test2_link_set_direction();
     if (all || test == 38) test3_link_set_direction();
+    if (all || test == 39) test1_link_copy_in();
 
   PRINT_PASSED_PERCENTAGE;
 
@@ -423,3 +424,15 @@ void test3_link_set_direction() {
     PRINT_TEST_RESULT(link_getDirection(link) == N);
     link_destroy(link);
 }
+
+void test1_link_copy_in() {
+    Link *link = NULL, *copy = NULL;
+    link = link_create();
+    link_setId(link, 5);
+    link_setOpen(link, FALSE);
+    copy = link_copy_in(NULL, link);
+    link_setOpen(copy, TRUE);
+    PRINT_TEST_RESULT(link_getId(copy) == 5 && link_getOpen(copy) == TRUE && link_getOpen(link) == FALSE);
+    link_destroy(copy);
+    link_destroy(link);
+}
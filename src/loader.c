@@ -0,0 +1,276 @@
+/**
+ * @brief It implements the background loading of a world
+ *
+ * The data file stays mapped until the thread is joined. The first player
+ * and its space are found by looking only at the tags and ids of the
+ * records; those two records are the only ones parsed before the game starts.
+ *
+ * @file loader.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "loader.h"
+#include "scan.h"
+#include "world.h"
+
+struct _Loader {
+  char *data;           /*!< Mapped data file */
+  size_t size;          /*!< Size of the data file */
+  W_World *world;       /*!< Every record of the file, parsed by the background thread */
+  BOOL has_player;      /*!< If the first player was added before the thread started */
+  Id start;             /*!< Space added before the thread started, NO_ID if none */
+  STATUS status;        /*!< Result of the background parse */
+  pthread_t thread;     /*!< Background thread */
+  BOOL running;         /*!< If the thread was started and not joined */
+  BOOL done;            /*!< If the thread finished */
+  BOOL applied;         /*!< If the rest of the world was added to the game */
+  pthread_mutex_t lock; /*!< Protects done */
+};
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Finds the first record with a tag, and with an id when it is not NO_ID
+ * @return the start of the record, with its graphic lines for spaces, or NULL
+ */
+static const char *loader_find(const Loader *loader, char tag, Id id, size_t *size) {
+  const char *p = loader->data, *end = loader->data + loader->size, *eol, *start;
+  ScanField f[3];
+  int i, nlines;
+
+  while (p < end) {
+    if (!(eol = memchr(p, '\n', end - p)))
+      eol = end;
+
+    if (eol - p < 3 || p[0] != '#' || p[2] != ':' || (p[1] != 's' && p[1] != tag)) {
+      p = eol + 1;
+      continue;
+    }
+
+    start = p;
+    scan_fields(p + 3, eol, f, 3);
+    if (p[1] == 's') {
+      nlines = scan_long(f[2].s, f[2].len);
+      for (i = 0; i < nlines && eol < end; i++) {
+        p = eol + 1;
+        if (!(eol = memchr(p, '\n', end - p)))
+          eol = end;
+      }
+    }
+
+    if (start[1] == tag && (id == NO_ID || scan_long(f[0].s, f[0].len) == id)) {
+      *size = eol - start;
+      return start;
+    }
+
+    p = eol + 1;
+  }
+
+  return NULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Parses the first player and its space and adds them to the game
+ */
+static STATUS loader_first(Loader *loader, Game *game) {
+  const char *record = NULL;
+  W_World *w = NULL;
+  STATUS status = OK;
+  size_t size;
+
+  if ((record = loader_find(loader, 'p', NO_ID, &size)) == NULL)
+    return OK;
+
+  if ((w = world_create()) == NULL)
+    return ERROR;
+
+  if (world_parse(w, record, size) == ERROR || w->n_players == 0) {
+    world_destroy(w);
+    return ERROR;
+  }
+
+  if ((record = loader_find(loader, 's', w->players[0].location, &size)) != NULL &&
+      world_parse(w, record, size) == OK && w->n_spaces > 0) {
+    /* The graphic lines are where the record is in the file */
+    w->spaces[0].offset += record - loader->data;
+    if ((status = world_add_space(game, &w->spaces[0])) == OK)
+      loader->start = w->spaces[0].id;
+  }
+
+  if (status == OK && (status = world_add_player(game, &w->players[0])) == OK)
+    loader->has_player = TRUE;
+
+  world_destroy(w);
+
+  return status;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+static void *loader_worker(void *arg) {
+  Loader *loader = (Loader *)arg;
+
+  loader->status = world_parse_parallel(loader->world, loader->data, loader->size, 0);
+
+  pthread_mutex_lock(&loader->lock);
+  loader->done = TRUE;
+  pthread_mutex_unlock(&loader->lock);
+
+  return NULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Waits for the background thread and unmaps the file, which is no longer needed
+ */
+static void loader_join(Loader *loader) {
+  if (loader->running) {
+    pthread_join(loader->thread, NULL);
+    loader->running = FALSE;
+  }
+
+  if (loader->data) {
+    munmap(loader->data, loader->size);
+    loader->data = NULL;
+  }
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+Loader *loader_start(Game *game, const char *filename) {
+  Loader *loader = NULL;
+  struct stat st;
+  int fd;
+
+  if (!game || !filename)
+    return NULL;
+
+  if ((loader = (Loader *)calloc(1, sizeof(Loader))) == NULL)
+    return NULL;
+  loader->start = NO_ID;
+  loader->status = OK;
+  pthread_mutex_init(&loader->lock, NULL);
+
+  if ((fd = open(filename, O_RDONLY)) < 0 || fstat(fd, &st) < 0) {
+    if (fd >= 0)
+      close(fd);
+    loader_destroy(loader);
+    return NULL;
+  }
+
+  if (st.st_size > 0) {
+    loader->data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (loader->data == MAP_FAILED) {
+      loader->data = NULL;
+      close(fd);
+      loader_destroy(loader);
+      return NULL;
+    }
+    loader->size = st.st_size;
+  }
+  close(fd);
+
+  if ((loader->world = world_create()) == NULL || loader_first(loader, game) == ERROR) {
+    loader_destroy(loader);
+    return NULL;
+  }
+
+  if (pthread_create(&loader->thread, NULL, loader_worker, loader) == 0)
+    loader->running = TRUE;
+  else
+    loader_worker(loader); /* Without a thread the rest is parsed now */
+
+  return loader;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS loader_destroy(Loader *loader) {
+  if (!loader)
+    return ERROR;
+
+  loader_join(loader);
+  world_destroy(loader->world);
+  pthread_mutex_destroy(&loader->lock);
+  free(loader);
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+BOOL loader_is_done(Loader *loader) {
+  BOOL done;
+
+  if (!loader)
+    return FALSE;
+
+  pthread_mutex_lock(&loader->lock);
+  done = loader->done;
+  pthread_mutex_unlock(&loader->lock);
+
+  return done;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS loader_finish(Loader *loader, Game *game) {
+  W_Fixups placed = {NULL, 0, 0}, attached = {NULL, 0, 0};
+  const W_World *w = NULL;
+  STATUS status = OK;
+  BOOL skip_space, skip_player;
+  int i;
+
+  if (!loader || !game)
+    return ERROR;
+
+  if (loader->applied)
+    return OK;
+
+  loader_join(loader);
+  loader->applied = TRUE;
+  if (loader->status == ERROR)
+    return ERROR;
+
+  /* The same records as world_apply, but for the first player and its space, which are already in */
+  w = loader->world;
+  skip_space = (loader->start != NO_ID);
+  skip_player = loader->has_player;
+
+  for (i = 0; status == OK && i < w->n_spaces; i++) {
+    if (skip_space && w->spaces[i].id == loader->start) {
+      skip_space = FALSE;
+      continue;
+    }
+    status = world_add_space(game, &w->spaces[i]);
+  }
+  for (i = 0; status == OK && i < w->n_objects; i++) {
+    status = world_add_object(game, &w->objects[i], &placed);
+  }
+  for (i = skip_player ? 1 : 0; status == OK && i < w->n_players; i++) {
+    status = world_add_player(game, &w->players[i]);
+  }
+  for (i = 0; status == OK && i < w->n_enemies; i++) {
+    status = world_add_enemy(game, &w->enemies[i]);
+  }
+  for (i = 0; status == OK && i < w->n_links; i++) {
+    status = world_add_link(game, &w->links[i], &attached);
+  }
+
+  if (status == OK) {
+    world_fixup(game, &placed, &attached);
+  }
+
+  free(placed.items);
+  free(attached.items);
+
+  if (status == OK)
+    status = game_resolve_links(game);
+
+  return status;
+}
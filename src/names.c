@@ -0,0 +1,244 @@
+/**
+ * @brief Implements the name index module
+ *
+ * The names are stored in lower case. Every name is in an open addressing
+ * hash table, that doubles when it gets half full, and in an array that is
+ * sorted again the first time a start of name is looked for after an add.
+ *
+ * @file names.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "names.h"
+
+#define NAMES_SLOTS 64
+
+/**
+ * @brief A name and the id it stands for
+ */
+typedef struct {
+    char *name;        /*Name in lower case, NULL if the slot is free*/
+    Id id;             /*Id of the entity*/
+    int order;         /*Position in which it was added*/
+} NameEntry;
+
+struct _NameIndex
+{
+    NameEntry *slots;  /*Hash table, with the first entry of every name*/
+    int n_slots;       /*Size of the hash table, power of two*/
+    NameEntry *sorted; /*Every entry, sorted by name when sorted_ok is TRUE*/
+    int n_names;       /*Number of names*/
+    int max_names;     /*Allocated size of sorted*/
+    BOOL sorted_ok;    /*If sorted is in order*/
+};
+
+/*----------------------------------------------------------------------------------------------------*/
+static unsigned int names_hash(const char *s)
+{
+    unsigned int h = 2166136261u;
+
+    for (; *s; s++)
+    {
+        h ^= (unsigned char)*s;
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Copies a name in lower case, at most len characters of it
+ */
+static void names_fold(char *dst, const char *src, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len && src[i]; i++)
+        dst[i] = tolower((unsigned char)src[i]);
+    dst[i] = '\0';
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+static int names_cmp(const void *a, const void *b)
+{
+    const NameEntry *x = a, *y = b;
+    int c = strcmp(x->name, y->name);
+
+    return c ? c : x->order - y->order;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+static int names_slot(const NameIndex *index, const char *name)
+{
+    int i = names_hash(name) & (index->n_slots - 1);
+
+    while (index->slots[i].name && strcmp(index->slots[i].name, name) != 0)
+        i = (i + 1) & (index->n_slots - 1);
+
+    return i;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+static STATUS names_grow(NameIndex *index)
+{
+    NameEntry *old = index->slots, *slots;
+    int n_old = index->n_slots, i;
+
+    if ((slots = (NameEntry *)calloc(2 * n_old, sizeof(NameEntry))) == NULL)
+        return ERROR;
+
+    index->slots = slots;
+    index->n_slots = 2 * n_old;
+    for (i = 0; i < n_old; i++)
+    {
+        if (old[i].name)
+            index->slots[names_slot(index, old[i].name)] = old[i];
+    }
+    free(old);
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+NameIndex *names_create()
+{
+    NameIndex *index;
+
+    index = (NameIndex *)calloc(1, sizeof(NameIndex));
+    if (!index)
+        return NULL;
+
+    if ((index->slots = (NameEntry *)calloc(NAMES_SLOTS, sizeof(NameEntry))) == NULL)
+    {
+        free(index);
+        return NULL;
+    }
+    index->n_slots = NAMES_SLOTS;
+    index->sorted_ok = TRUE;
+
+    return index;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+STATUS names_destroy(NameIndex *index)
+{
+    int i;
+
+    if (!index)
+        return ERROR;
+
+    /* The hash table only points to the names of sorted */
+    for (i = 0; i < index->n_names; i++)
+        free(index->sorted[i].name);
+    free(index->sorted);
+    free(index->slots);
+    free(index);
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+STATUS names_add(NameIndex *index, const char *name, Id id)
+{
+    NameEntry *aux;
+    char *folded;
+    int i, len;
+
+    if (!index || !name)
+        return ERROR;
+
+    if (index->n_names == index->max_names)
+    {
+        aux = (NameEntry *)realloc(index->sorted, (2 * index->max_names + NAMES_SLOTS) * sizeof(NameEntry));
+        if (!aux)
+            return ERROR;
+        index->sorted = aux;
+        index->max_names = 2 * index->max_names + NAMES_SLOTS;
+    }
+
+    if (2 * (index->n_names + 1) > index->n_slots && names_grow(index) == ERROR)
+        return ERROR;
+
+    len = strlen(name);
+    if ((folded = (char *)malloc(len + 1)) == NULL)
+        return ERROR;
+    names_fold(folded, name, len);
+
+    aux = &index->sorted[index->n_names];
+    aux->name = folded;
+    aux->id = id;
+    aux->order = index->n_names++;
+    index->sorted_ok = FALSE;
+
+    i = names_slot(index, folded);
+    if (!index->slots[i].name)
+        index->slots[i] = *aux;
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+Id names_find(NameIndex *index, const char *name)
+{
+    char folded[WORD_SIZE];
+    int i, lo, hi, mid, len;
+    Id id;
+
+    if (!index || !name || !name[0])
+        return NO_ID;
+
+    len = strlen(name);
+    if (len >= WORD_SIZE)
+        return NO_ID;
+    names_fold(folded, name, len);
+
+    i = names_slot(index, folded);
+    if (index->slots[i].name)
+        return index->slots[i].id;
+
+    if (!index->sorted_ok)
+    {
+        qsort(index->sorted, index->n_names, sizeof(NameEntry), names_cmp);
+        index->sorted_ok = TRUE;
+    }
+
+    /* The first name not smaller than the start given */
+    lo = 0;
+    hi = index->n_names;
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (strcmp(index->sorted[mid].name, folded) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if (lo == index->n_names || strncmp(index->sorted[lo].name, folded, len) != 0)
+        return NO_ID;
+
+    /* Several names may start that way, they must all be the same entity */
+    id = index->sorted[lo].id;
+    for (i = lo + 1; i < index->n_names && strncmp(index->sorted[i].name, folded, len) == 0; i++)
+    {
+        if (index->sorted[i].id != id)
+            return NO_ID;
+    }
+
+    return id;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+int names_get_number(NameIndex *index)
+{
+    if (!index)
+        return -1;
+
+    return index->n_names;
+}
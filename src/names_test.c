@@ -0,0 +1,159 @@
+/** 
+ * @brief It tests the name index module
+ * 
+ * @file names_test.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+#include "names.h"
+#include "names_test.h"
+#include "test.h"
+
+#define MAX_TESTS 12
+
+/** 
+ * @brief Main function for NAMES unit tests. 
+ * 
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed 
+ *   2.- A number means a particular test (the one identified by that number) 
+ *       is executed
+ *  
+ */
+int main(int argc, char** argv) {
+
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2) {
+    printf("Running all test for module Names:\n");
+  } else {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS) {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+
+  if (all || test == 1) test1_names_create();
+  if (all || test == 2) test1_names_destroy();
+  if (all || test == 3) test2_names_destroy();
+  if (all || test == 4) test1_names_add();
+  if (all || test == 5) test2_names_add();
+  if (all || test == 6) test1_names_find();
+  if (all || test == 7) test2_names_find();
+  if (all || test == 8) test3_names_find();
+  if (all || test == 9) test4_names_find();
+  if (all || test == 10) test5_names_find();
+  if (all || test == 11) test6_names_find();
+  if (all || test == 12) test1_names_get_number();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/** 
+ * @brief Makes an index with some of the objects of the game
+ */
+static NameIndex *make_index() {
+  NameIndex *index = names_create();
+  names_add(index, "Grano", 201);
+  names_add(index, "Wood_Sword", 202);
+  names_add(index, "Iron_Sword", 203);
+  names_add(index, "Pizza_Box", 204);
+  names_add(index, "Pizza", 205);
+  return index;
+}
+
+void test1_names_create() {
+  NameIndex *n;
+  n = names_create();
+  PRINT_TEST_RESULT(n != NULL && names_get_number(n) == 0);
+  names_destroy(n);
+}
+
+void test1_names_destroy() {
+  NameIndex *n;
+  n = make_index();
+  PRINT_TEST_RESULT(names_destroy(n) == OK);
+}
+
+void test2_names_destroy() {
+  NameIndex *n = NULL;
+  PRINT_TEST_RESULT(names_destroy(n) == ERROR);
+}
+
+void test1_names_add() {
+  NameIndex *n;
+  n = names_create();
+  PRINT_TEST_RESULT(names_add(n, NULL, 1) == ERROR);
+  names_destroy(n);
+}
+
+void test2_names_add() {
+  NameIndex *n;
+  n = make_index();
+  names_add(n, "GRANO", 299);
+  PRINT_TEST_RESULT(names_find(n, "grano") == 201);
+  names_destroy(n);
+}
+
+void test1_names_find() {
+  NameIndex *n;
+  n = make_index();
+  PRINT_TEST_RESULT(names_find(n, "Iron_Sword") == 203);
+  names_destroy(n);
+}
+
+void test2_names_find() {
+  NameIndex *n;
+  n = make_index();
+  PRINT_TEST_RESULT(names_find(n, "wOOd_sWORD") == 202);
+  names_destroy(n);
+}
+
+void test3_names_find() {
+  NameIndex *n;
+  n = make_index();
+  PRINT_TEST_RESULT(names_find(n, "gra") == 201);
+  names_destroy(n);
+}
+
+void test4_names_find() {
+  NameIndex *n;
+  n = make_index();
+  PRINT_TEST_RESULT(names_find(n, "pizza") == 205 && names_find(n, "Pizz") == NO_ID);
+  names_destroy(n);
+}
+
+void test5_names_find() {
+  NameIndex *n;
+  n = make_index();
+  PRINT_TEST_RESULT(names_find(n, "Sword") == NO_ID && names_find(n, "") == NO_ID);
+  names_destroy(n);
+}
+
+void test6_names_find() {
+  NameIndex *n;
+  n = make_index();
+  names_find(n, "gra");
+  names_add(n, "Gravel", 206);
+  PRINT_TEST_RESULT(names_find(n, "gra") == NO_ID && names_find(n, "grav") == 206);
+  names_destroy(n);
+}
+
+void test1_names_get_number() {
+  NameIndex *n;
+  n = make_index();
+  PRINT_TEST_RESULT(names_get_number(n) == 5);
+  names_destroy(n);
+}
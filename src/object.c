@@ -11,13 +11,14 @@
 struct _Object
 {
     Id id;                      /*!< Id number of the object, it must be unique */
-    char name[WORD_SIZE + 1];   /*!< Name of the object */
-    char description[235];      /*!< Description of the object */
+    StrId name;                 /*!< Name of the object, in the table of the program */
+    StrId description;          /*!< Description of the object, in the table of the program */
     BOOL consumable;            /*!< If the object is consumable or not */
     int type;                   /*!< Type of the object (1 = common, 2 = rare, 3 = epic, 4 = legendary) */
     BD *buff;                   /*!< Buffs of the object */
     BD *debuff;                 /*!< Debuffs of the object */
     int position[3][3];         /*!< Position of the object */
+    Arena *arena;               /*!< Arena the object comes from, NULL if it is in the heap */
 };
 
 /**
@@ -26,6 +27,17 @@ struct _Object
   * @return a new object, initialized
   */
 Object *object_create(Id id)
+{
+    return object_create_in(NULL, id);
+}
+
+/**
+  * @brief It creates a new object taking the memory from an arena
+  * @param arena the arena, or NULL to use the heap
+  * @param id the identification number for the new object
+  * @return a new object, initialized
+  */
+Object *object_create_in(Arena *arena, Id id)
 {
     Object *newObject = NULL;
 
@@ -33,7 +45,7 @@ Object *object_create(Id id)
     if (id == NO_ID)
         return NULL;
 
-    newObject = (Object *)malloc(sizeof(Object));
+    newObject = (Object *)arena_alloc(arena, sizeof(Object));
     if (newObject == NULL)
     {
         return NULL;
@@ -41,15 +53,51 @@ Object *object_create(Id id)
 
     /* Initialization of an new object*/
     newObject->id = id;
-    newObject->name[0] = '\0';
+    newObject->name = NO_STR;
+    newObject->description = NO_STR;
     newObject->consumable = FALSE;
     newObject->type = 0;
     newObject->buff = NULL;
     newObject->debuff = NULL;
+    newObject->arena = arena;
 
     return newObject;
 }
 
+/**
+  * @brief It creates a new object equal to another one, with its own buff and debuff, taking the memory from an arena
+  * @param arena the arena, or NULL to use the heap
+  * @param object a pointer to the object to copy
+  * @return a new object, or NULL
+  */
+Object *object_copy_in(Arena *arena, Object *object)
+{
+    Object *copy = NULL;
+
+    if (!object)
+        return NULL;
+
+    copy = (Object *)arena_alloc(arena, sizeof(Object));
+    if (copy == NULL)
+    {
+        return NULL;
+    }
+
+    *copy = *object;
+    copy->arena = arena;
+    copy->buff = copy->debuff = NULL;
+
+    if ((object->buff && (copy->buff = bd_copy_in(arena, object->buff)) == NULL) ||
+        (object->debuff && (copy->debuff = bd_copy_in(arena, object->debuff)) == NULL))
+    {
+        bd_destroy(copy->buff);
+        arena_free(arena, copy, sizeof(Object));
+        return NULL;
+    }
+
+    return copy;
+}
+
 /**
   * @brief It destroys an object, freeing the allocated memory
   * @param object a pointer to the space that must be destroyed  
@@ -62,7 +110,7 @@ STATUS object_destroy(Object *object)
         return ERROR;
     }
 
-    free(object);
+    arena_free(object->arena, object, sizeof(Object));
     object = NULL;
     return OK;
 }
@@ -104,15 +152,18 @@ Id object_get_id(Object *object)
   */
 STATUS object_set_name(Object *object, char *name)
 {
+    StrId id;
+
     if (!object || !name)
     {
         return ERROR;
     }
 
-    if (!strcpy(object->name, name))
+    if ((id = strtab_id(name)) == NO_STR && name[0])
     {
         return ERROR;
     }
+    object->name = id;
     return OK;
 }
 
@@ -127,6 +178,20 @@ const char *object_get_name(Object *object)
     {
         return NULL;
     }
+    return strtab_str(object->name);
+}
+
+/**
+  * @brief It gets the handle of the name of an object
+  * @param object a pointer to the object
+  * @return the handle of the name, NO_STR if it has none
+  */
+StrId object_get_name_id(Object *object)
+{
+    if (!object)
+    {
+        return NO_STR;
+    }
     return object->name;
 }
 
@@ -138,15 +203,18 @@ const char *object_get_name(Object *object)
   */
 STATUS object_set_desc(Object *object, char *desc)
 {
+    StrId id;
+
     if (!object || !desc)
     {
         return ERROR;
     }
 
-    if (!strcpy(object->description, desc))
+    if ((id = strtab_id(desc)) == NO_STR && desc[0])
     {
         return ERROR;
     }
+    object->description = id;
     return OK;
 }
 
@@ -161,7 +229,7 @@ const char *object_get_desc(Object *object)
     {
         return NULL;
     }
-    return object->description;
+    return strtab_str(object->description);
 }
 
 /**
@@ -178,7 +246,7 @@ STATUS object_print(Object *object)
     }
 
     /* Print the id and the name of the object */
-    fprintf(stdout, "--> Object (Id: %ld; Name: %s\n", object->id, object->name);
+    fprintf(stdout, "--> Object (Id: %ld; Name: %s\n", object->id, strtab_str(object->name));
 
     return OK;
 }
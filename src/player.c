@@ -10,7 +10,7 @@
 
 struct _Player {
     Id id;                      /*Structure player's id*/
-    char name[WORD_SIZE + 1];   /*Player's name*/
+    StrId name;                 /*Player's name, in the table of the program*/
     Id location;                /*Where the player is*/
     Inventory *objects;         /*Objects weared by the player*/
     int health;                 /*player's health*/
@@ -18,27 +18,34 @@ struct _Player {
     float attack;                 /*player's attack*/
     float defense;                /*player's defense*/
     BOOL position[3][3];         /*Player's position*/
+    Arena *arena;               /*Arena the player comes from, NULL if it is in the heap*/
     int i_pos;                  /*Player's i position*/
     int j_pos;                  /*Player's j position*/
 };
 
 /*----------------------------------------------------------------------------------------------------*/
 Player *player_create(Id id) {
+    return player_create_in(NULL, id);
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+Player *player_create_in(Arena *arena, Id id) {
     Player *aux = NULL;
 
     if(id == NO_ID) 
         return NULL;
     
-    aux = (Player*) malloc(sizeof(Player));
+    aux = (Player*) arena_alloc(arena, sizeof(Player));
     if(!aux)
         return NULL;
     
     /*initialization of Player Struct*/
     aux->id = id;
-    aux->name[0] = 0;
+    aux->name = NO_STR;
     aux->objects = NULL; 
     aux->health = 25;
-    aux->xp = xp_create();
+    aux->xp = xp_create_in(arena);
+    aux->arena = arena;
     aux->attack = 1;
     aux->defense = 0;
     aux->i_pos = -1;
@@ -47,6 +54,32 @@ Player *player_create(Id id) {
     return aux;
 }
 
+/*----------------------------------------------------------------------------------------------------*/
+Player *player_copy_in(Arena *arena, Player *p) {
+    Player *aux = NULL;
+
+    if(!p)
+        return NULL;
+
+    aux = (Player*) arena_alloc(arena, sizeof(Player));
+    if(!aux)
+        return NULL;
+
+    *aux = *p;
+    aux->arena = arena;
+    aux->objects = NULL;
+    aux->xp = NULL;
+
+    /*the inventory and the xp are its own*/
+    if((p->objects && (aux->objects = inventory_copy_in(arena, p->objects)) == NULL) ||
+       (p->xp && (aux->xp = xp_copy_in(arena, p->xp)) == NULL)) {
+        player_destroy(aux);
+        return NULL;
+    }
+
+    return aux;
+}
+
 /*----------------------------------------------------------------------------------------------------*/
 Id player_getId(Player *p) {
     if(!p)
@@ -69,15 +102,27 @@ char *player_getName(Player *p) {
     if(!p)
         return NULL;
     
+    return (char*) strtab_str(p->name);
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+StrId player_getNameId(Player *p) {
+    if(!p)
+        return NO_STR;
+    
     return p->name;
 }
 
 /*----------------------------------------------------------------------------------------------------*/
 STATUS player_setName(Player *p, char *name) {
+    StrId id;
+
     if(!p || !name)
         return ERROR;
     
-    strcpy(p->name, name);
+    if((id = strtab_id(name)) == NO_STR && name[0])
+        return ERROR;
+    p->name = id;
     return OK;
 }
 
@@ -163,7 +208,8 @@ STATUS player_destroy(Player *p) {
         return ERROR;
     
     inventory_destroy(p->objects);
-    free(p);
+    xp_destroy(p->xp);
+    arena_free(p->arena, p, sizeof(Player));
     p = NULL;
     return OK;
 }
@@ -0,0 +1,218 @@
+/**
+ * @brief It measures how fast the records of a data file are split and parsed
+ *
+ * The records of the file are found first, and then every record is parsed
+ * as the loaders used to do it, with strtok, atol and atof on a copy of the
+ * line, and with the tokenizer of scan.h. The whole file is also parsed into
+ * a world with world_parse, which includes finding the lines and skipping
+ * the graphic descriptions. Every pass is repeated and the best time is shown.
+ *
+ * @file reader_bench.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "reader_bench.h"
+
+#define BENCH_FIELDS 16
+#define BENCH_ROUNDS 5
+
+/**
+ * @brief Fields of each kind of record that are floats, one bit per field
+ */
+static unsigned bench_floats(char tag) {
+  switch (tag) {
+    case 'o':
+      return (1u << 5) | (1u << 7);
+    case 'p':
+      return (1u << 5) | (1u << 6);
+    case 'e':
+      return (1u << 4) | (1u << 5);
+    default:
+      return 0;
+  }
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+static double bench_now() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Finds the records of the data, so that looking for the lines is not measured
+ * @return the start of every record, followed by the end of its line
+ */
+static const char **bench_index(const char *data, size_t size, long *records) {
+  const char *p = data, *end = data + size, *eol, **index = NULL, **aux = NULL;
+  long max = 0;
+
+  *records = 0;
+  while (p < end) {
+    if (!(eol = memchr(p, '\n', end - p)))
+      eol = end;
+    if (eol - p > 3 && p[0] == '#' && p[2] == ':') {
+      if (2 * *records + 2 > max) {
+        if ((aux = realloc(index, (max + 1024 + max / 2) * sizeof(char *))) == NULL) {
+          free(index);
+          return NULL;
+        }
+        index = aux;
+        max += 1024 + max / 2;
+      }
+      index[2 * *records] = p;
+      index[2 * *records + 1] = eol;
+      (*records)++;
+    }
+    p = eol + 1;
+  }
+
+  return index;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Parses every record with strtok, atol and atof on a copy of its line, like the loaders did
+ * @return a sum of the values, so the work is not optimised away
+ */
+static double bench_strtok(const char **index, long records) {
+  char line[BUFSIZ], *tok;
+  unsigned floats;
+  double sum = 0;
+  long r;
+  int i;
+
+  for (r = 0; r < records; r++) {
+    if ((size_t)(index[2 * r + 1] - index[2 * r]) >= sizeof(line))
+      continue;
+    memcpy(line, index[2 * r], index[2 * r + 1] - index[2 * r]);
+    line[index[2 * r + 1] - index[2 * r]] = '\0';
+    floats = bench_floats(line[1]);
+    for (i = 0, tok = strtok(line + 3, "|"); tok; i++, tok = strtok(NULL, "|")) {
+      if (i == 1)
+        continue;
+      sum += (floats & (1u << i)) ? atof(tok) : atol(tok);
+    }
+  }
+
+  return sum;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Parses every record in place with scan_fields, scan_long and scan_float
+ * @return a sum of the values, so the work is not optimised away
+ */
+static double bench_scan(const char **index, long records) {
+  ScanField f[BENCH_FIELDS];
+  unsigned floats;
+  double sum = 0;
+  long r;
+  int i, n;
+
+  for (r = 0; r < records; r++) {
+    floats = bench_floats(index[2 * r][1]);
+    n = scan_fields(index[2 * r] + 3, index[2 * r + 1], f, BENCH_FIELDS);
+    for (i = 0; i < n; i++) {
+      if (i == 1)
+        continue;
+      sum += (floats & (1u << i)) ? scan_float(f[i].s, f[i].len) : scan_long(f[i].s, f[i].len);
+    }
+  }
+
+  return sum;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+static void bench_report(const char *name, double secs, long records) {
+  printf("%-12s %9.3f ms %9.1f ns/record\n", name, secs * 1e3, secs * 1e9 / (records ? records : 1));
+}
+
+/*main program*/
+int main(int argc, char *argv[]) {
+  double best[3] = {1e9, 1e9, 1e9}, t, sums[2] = {0, 0};
+  char *data = NULL, *aux = NULL;
+  const char **index = NULL;
+  size_t size = 0, max = 0, n;
+  long records = 0;
+  W_World *w = NULL;
+  FILE *file = NULL;
+  int copies = 1, r, c;
+
+  if (argc < 2 || argc > 3) {
+    fprintf(stderr, "Use: %s <game_data_file> [<copies>]\n", argv[0]);
+    return 1;
+  }
+  if (argc == 3 && (copies = atoi(argv[2])) < 1)
+    copies = 1;
+
+  if ((file = fopen(argv[1], "r")) == NULL) {
+    fprintf(stderr, "Error while opening %s.\n", argv[1]);
+    return 1;
+  }
+
+  /* The file is repeated to get a size that can be measured */
+  do {
+    if (size + BUFSIZ > max) {
+      if ((aux = realloc(data, max + BUFSIZ + max)) == NULL)
+        break;
+      data = aux;
+      max += BUFSIZ + max;
+    }
+    n = fread(data + size, 1, max - size, file);
+    size += n;
+  } while (n > 0);
+  fclose(file);
+  if (!data || (aux = realloc(data, size * copies + 1)) == NULL) {
+    free(data);
+    return 1;
+  }
+  data = aux;
+  for (c = 1; c < copies; c++)
+    memcpy(data + size * c, data, size);
+  size *= copies;
+
+  if ((index = bench_index(data, size, &records)) == NULL) {
+    free(data);
+    return 1;
+  }
+
+  for (r = 0; r < BENCH_ROUNDS; r++) {
+    t = bench_now();
+    sums[0] = bench_strtok(index, records);
+    if ((t = bench_now() - t) < best[0])
+      best[0] = t;
+
+    t = bench_now();
+    sums[1] = bench_scan(index, records);
+    if ((t = bench_now() - t) < best[1])
+      best[1] = t;
+
+    t = bench_now();
+    if ((w = world_create()) != NULL) {
+      world_parse(w, data, size);
+      world_destroy(w);
+    }
+    if ((t = bench_now() - t) < best[2])
+      best[2] = t;
+  }
+
+  printf("%s x%d: %zu bytes, %ld records, delimiters with %s\n", argv[1], copies, size, records, scan_isa());
+  bench_report("strtok/atof", best[0], records);
+  bench_report("scan", best[1], records);
+  bench_report("world_parse", best[2], records);
+  printf("speedup %.2fx", best[0] / best[1]);
+  if (sums[0] != sums[1])
+    printf(" (the sums differ: %g and %g, the strtok path reads ',' decimals as 0)", sums[0], sums[1]);
+  printf("\n");
+
+  free(index);
+  free(data);
+
+  return 0;
+}
@@ -0,0 +1,220 @@
+/**
+ * @brief It implements the record tokenizer used by the loaders
+ *
+ * The line is read in blocks of 32 bytes (16 with SSE2). For every block a
+ * bit mask of the '|' and one of the '\n' in it are made, and the fields are
+ * taken from the set bits, so the bytes inside a field are never looked at
+ * one by one.
+ *
+ * @file scan.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdint.h>
+#include "scan.h"
+
+#if defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__))
+#define SCAN_X86
+#include <immintrin.h>
+#endif
+
+#define SCAN_BLOCK 32 /* the widest block, the masks have one bit per byte */
+#define MAX_DIGITS 19 /* more digits do not fit in the mantissa */
+
+/**
+ * @brief Makes the masks of the delimiters in a block of bytes
+ */
+typedef void (*scan_block_fn)(const char *p, int len, uint32_t *bars, uint32_t *nls);
+
+/*--------------------------------------------------------------------------------------------------------*/
+static void scan_block_scalar(const char *p, int len, uint32_t *bars, uint32_t *nls) {
+  int i;
+
+  *bars = *nls = 0;
+  for (i = 0; i < len; i++) {
+    if (p[i] == '|')
+      *bars |= (uint32_t)1 << i;
+    else if (p[i] == '\n')
+      *nls |= (uint32_t)1 << i;
+  }
+}
+
+#ifdef SCAN_X86
+/*--------------------------------------------------------------------------------------------------------*/
+static void scan_block_sse2(const char *p, int len, uint32_t *bars, uint32_t *nls) {
+  __m128i v = _mm_loadu_si128((const __m128i *)p);
+
+  (void)len;
+  *bars = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('|')));
+  *nls = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+__attribute__((target("avx2")))
+static void scan_block_avx2(const char *p, int len, uint32_t *bars, uint32_t *nls) {
+  __m256i v = _mm256_loadu_si256((const __m256i *)p);
+
+  (void)len;
+  *bars = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('|')));
+  *nls = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')));
+}
+#endif
+
+static scan_block_fn scan_block = scan_block_scalar; /* block used for whole blocks */
+static int scan_width = SCAN_BLOCK;                  /* bytes of a whole block */
+static const char *scan_name = "scalar";             /* instruction set of scan_block */
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Chooses the widest block the processor supports, before main runs and any thread is started
+ */
+__attribute__((constructor))
+static void scan_init() {
+#ifdef SCAN_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    scan_block = scan_block_avx2;
+    scan_width = 32;
+    scan_name = "avx2";
+  } else {
+    scan_block = scan_block_sse2;
+    scan_width = 16;
+    scan_name = "sse2";
+  }
+#endif
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+int scan_fields(const char *p, const char *end, ScanField *fields, int max) {
+  const char *start = p, *q;
+  uint32_t bars, nls;
+  int n = 0, len, i;
+  int stop = 0;
+
+  while (p < end && !stop && n < max) {
+    len = (end - p < scan_width) ? end - p : scan_width;
+    if (len == scan_width)
+      scan_block(p, len, &bars, &nls);
+    else
+      scan_block_scalar(p, len, &bars, &nls);
+
+    /* Nothing after the end of the line belongs to the record */
+    if (nls) {
+      len = __builtin_ctz(nls);
+      bars &= ((uint32_t)1 << len) - 1;
+      stop = 1;
+    }
+
+    while (bars && n < max) {
+      q = p + __builtin_ctz(bars);
+      bars &= bars - 1;
+      if (q > start) {
+        fields[n].s = start;
+        fields[n].len = q - start;
+        n++;
+      }
+      start = q + 1;
+    }
+
+    p += len;
+  }
+
+  if (n < max && p > start) {
+    fields[n].s = start;
+    fields[n].len = p - start;
+    n++;
+  }
+
+  for (i = n; i < max; i++) {
+    fields[i].s = p;
+    fields[i].len = 0;
+  }
+
+  return n;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+long scan_long(const char *s, size_t len) {
+  const char *end = s + len;
+  unsigned long n = 0;
+  int neg = 0;
+
+  if (!s)
+    return 0;
+
+  while (s < end && (*s == ' ' || *s == '\t'))
+    s++;
+  if (s < end && (*s == '-' || *s == '+'))
+    neg = (*s++ == '-');
+  while (s < end && *s >= '0' && *s <= '9')
+    n = n * 10 + (*s++ - '0');
+
+  return neg ? -(long)n : (long)n;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+float scan_float(const char *s, size_t len) {
+  static const double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  const char *end = s + len;
+  uint64_t mantissa = 0;
+  int digits = 0, exp = 0, e = 0, neg = 0, eneg = 0;
+  double value;
+
+  if (!s)
+    return 0;
+
+  while (s < end && (*s == ' ' || *s == '\t'))
+    s++;
+  if (s < end && (*s == '-' || *s == '+'))
+    neg = (*s++ == '-');
+
+  for (; s < end && *s >= '0' && *s <= '9'; s++) {
+    if (digits < MAX_DIGITS) {
+      mantissa = mantissa * 10 + (*s - '0');
+      digits += (mantissa != 0);
+    } else {
+      exp++;
+    }
+  }
+
+  if (s < end && (*s == '.' || *s == ',')) {
+    for (s++; s < end && *s >= '0' && *s <= '9'; s++) {
+      if (digits < MAX_DIGITS) {
+        mantissa = mantissa * 10 + (*s - '0');
+        digits += (mantissa != 0);
+        exp--;
+      }
+    }
+  }
+
+  if (s + 1 < end && (*s == 'e' || *s == 'E')) {
+    s++;
+    if (*s == '-' || *s == '+')
+      eneg = (*s++ == '-');
+    for (; s < end && *s >= '0' && *s <= '9' && e < 1000; s++)
+      e = e * 10 + (*s - '0');
+    exp += eneg ? -e : e;
+  }
+
+  /* Up to 10^22 the power is exact, so the result is rounded only once like strtod does */
+  value = (double)mantissa;
+  while (exp > 22) {
+    value *= 1e22;
+    exp -= 22;
+  }
+  while (exp < -22) {
+    value /= 1e22;
+    exp += 22;
+  }
+  value = (exp < 0) ? value / pow10[-exp] : value * pow10[exp];
+
+  return (float)(neg ? -value : value);
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+const char *scan_isa() {
+  return scan_name;
+}
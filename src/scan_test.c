@@ -0,0 +1,120 @@
+/** 
+ * @brief It tests the record tokenizer
+ * 
+ * @file scan_test.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+#include <locale.h>
+#include "scan.h"
+#include "scan_test.h"
+#include "test.h"
+
+#define MAX_TESTS 11
+
+/** 
+ * @brief Main function for SCAN unit tests. 
+ * 
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed 
+ *   2.- A number means a particular test (the one identified by that number) 
+ *       is executed
+ *  
+ */
+int main(int argc, char** argv) {
+
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2) {
+    printf("Running all test for module Scan (%s):\n", scan_isa());
+  } else {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS) {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+
+  if (all || test == 1) test1_scan_fields();
+  if (all || test == 2) test2_scan_fields();
+  if (all || test == 3) test3_scan_fields();
+  if (all || test == 4) test4_scan_fields();
+  if (all || test == 5) test5_scan_fields();
+  if (all || test == 6) test1_scan_long();
+  if (all || test == 7) test2_scan_long();
+  if (all || test == 8) test1_scan_float();
+  if (all || test == 9) test2_scan_float();
+  if (all || test == 10) test3_scan_float();
+  if (all || test == 11) test4_scan_float();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_scan_fields() {
+  const char *s = "1122|Start|27|";
+  ScanField f[3];
+  PRINT_TEST_RESULT(scan_fields(s, s + strlen(s), f, 3) == 3 && f[1].len == 5 && strncmp(f[1].s, "Start", 5) == 0);
+}
+
+void test2_scan_fields() {
+  const char *s = "204|Pizza_Box|1105||2|";
+  ScanField f[5];
+  PRINT_TEST_RESULT(scan_fields(s, s + strlen(s), f, 5) == 4 && strncmp(f[3].s, "2", f[3].len) == 0 && f[4].len == 0);
+}
+
+void test3_scan_fields() {
+  const char *s = "1|a|\n2|b|";
+  ScanField f[4];
+  PRINT_TEST_RESULT(scan_fields(s, s + strlen(s), f, 4) == 2);
+}
+
+void test4_scan_fields() {
+  const char *s = "225|Energy_Balls_With_A_Very_Long_Name_Crossing_Blocks|1309|3|1|2|3|15|-1|0|1|2|0|";
+  ScanField f[13];
+  PRINT_TEST_RESULT(scan_fields(s, s + strlen(s), f, 13) == 13 && f[12].len == 1 && f[12].s[0] == '0' &&
+                    f[1].len == 50);
+}
+
+void test5_scan_fields() {
+  const char *s = "1|2|3|4|";
+  ScanField f[2];
+  PRINT_TEST_RESULT(scan_fields(s, s + strlen(s), f, 2) == 2 && f[1].s[0] == '2');
+}
+
+void test1_scan_long() {
+  PRINT_TEST_RESULT(scan_long(" -1303|", 7) == -1303);
+}
+
+void test2_scan_long() {
+  PRINT_TEST_RESULT(scan_long("7.5", 3) == 7 && scan_long(NULL, 0) == 0 && scan_long("", 0) == 0);
+}
+
+void test1_scan_float() {
+  PRINT_TEST_RESULT(scan_float("2.75", 4) == 2.75f && scan_float("-0.5", 4) == -0.5f);
+}
+
+void test2_scan_float() {
+  PRINT_TEST_RESULT(scan_float("0,5|1|", 6) == 0.5f);
+}
+
+void test3_scan_float() {
+  PRINT_TEST_RESULT(scan_float("0.3", 3) == (float)atof("0.3") && scan_float("1.5e2", 5) == 150.0f);
+}
+
+void test4_scan_float() {
+  /* The result must not change with a locale whose decimal separator is ',' */
+  setlocale(LC_NUMERIC, "es_ES.UTF-8");
+  PRINT_TEST_RESULT(scan_float("3.8", 3) == 3.8f && scan_float("3,8", 3) == 3.8f);
+  setlocale(LC_NUMERIC, "C");
+}
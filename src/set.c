@@ -1,99 +1,386 @@
 /**
  * @brief Implements the set module
  *
+ * The ids are kept one after the other in an array, first inside the set
+ * itself and, when they do not fit there, in an array that doubles every
+ * time it is full. Sets with more than SET_INLINE ids also have an open
+ * addressing hash table with linear probing, with the position of every id
+ * in the array, that doubles when it gets half full. Deleting an id moves
+ * the last one into its place, and shifts back the slots that follow it in
+ * its run, as in idmap.c.
+ *
+ * Sets without a hash table are searched two ids at a time with SSE2, or
+ * four with AVX2 when the program is built for it. The ids are too few for
+ * the choice to be made when the program starts, as scan.c does: the call
+ * through a pointer would cost more than the compares it saves.
+ *
  * @file set.c
  * @author Miguel Paterson
  * @date 27-02-2023
  * @copyright GNU Public License
  */
 
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include "set.h"
 
+/* The compares are of 64 bits, as an Id is there */
+#if defined(__x86_64__) && defined(__LP64__)
+#define SET_X86
+#include <immintrin.h>
+#endif
+
+#define SET_INLINE 8 /*Ids kept inside the set, without a hash table*/
+
 struct _Set
 {
-    Id *id;   /*Dinamic array to ids*/
-    int n_id; /*Number of Id*/
+    Id *id;                  /*Array of ids, inline or allocated*/
+    int n_id;                /*Number of Id*/
+    int max;                 /*Size of the array of ids*/
+    int *slots;              /*Hash table with the position of each id, -1 if free, NULL while they are inline*/
+    int n_slots;             /*Size of the hash table, power of two*/
+    Arena *arena;            /*Arena the set and its ids come from, NULL if they are in the heap*/
+    Id inline_id[SET_INLINE]; /*The ids while they fit*/
 };
 
+/**
+ * @brief Gives the slot where an id should be first looked for
+ */
+static int set_hash(Set *s, Id id)
+{
+    /* Ids come in runs of close numbers, the multiplication spreads them over the table */
+    return (int)(((uint64_t)id * 0x9E3779B97F4A7C15ull) >> 32) & (s->n_slots - 1);
+}
+
+/**
+ * @brief Gives the slot of an id in the hash table, or the free slot where it would go
+ */
+static int set_find(Set *s, Id id)
+{
+    int i = set_hash(s, id);
+
+    while (s->slots[i] != -1 && s->id[s->slots[i]] != id)
+        i = (i + 1) & (s->n_slots - 1);
+
+    return i;
+}
+
+/**
+ * @brief Gives the position of an id in an array of n ids, -1 if it is not there
+ */
+static int set_scan(const Id *ids, int n, Id id)
+{
+    int i = 0;
+#if defined(SET_X86) && defined(__AVX2__)
+    __m256i key4 = _mm256_set1_epi64x(id);
+    int mask;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(ids + i)), key4)));
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+#endif
+#ifdef SET_X86
+    __m128i key2 = _mm_set1_epi64x(id), eq;
+    int mask2;
+
+    for (; i + 2 <= n; i += 2)
+    {
+        /* SSE2 only compares halves of 64 bits, an id is equal if both of its halves are */
+        eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(ids + i)), key2);
+        eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+        if ((mask2 = _mm_movemask_pd(_mm_castsi128_pd(eq))) != 0)
+            return i + __builtin_ctz(mask2);
+    }
+#endif
+
+    for (; i < n; i++)
+    {
+        if (ids[i] == id)
+            return i;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Gives the position of an id in the array, -1 if it is not in the set
+ */
+static int set_position(Set *s, Id id)
+{
+    if (s->slots)
+        return s->slots[set_find(s, id)];
+
+    return set_scan(s->id, s->n_id, id);
+}
+
+/**
+ * @brief Makes a hash table of n_slots slots with every id of the set
+ */
+static STATUS set_index(Set *s, int n_slots)
+{
+    int *slots, i;
+
+    if ((slots = (int *)arena_alloc(s->arena, n_slots * sizeof(int))) == NULL)
+        return ERROR;
+
+    arena_free(s->arena, s->slots, s->n_slots * sizeof(int));
+    s->slots = slots;
+    s->n_slots = n_slots;
+    for (i = 0; i < n_slots; i++)
+        s->slots[i] = -1;
+    for (i = 0; i < s->n_id; i++)
+        s->slots[set_find(s, s->id[i])] = i;
+
+    return OK;
+}
+
+/**
+ * @brief Makes room for one more id, moving them out of the set and making the hash table if needed
+ */
+static STATUS set_grow(Set *s)
+{
+    Id *aux = NULL;
+    int max;
+
+    if (s->n_id < s->max)
+        return OK;
+
+    max = 2 * s->max;
+    if (s->id == s->inline_id)
+    {
+        if ((aux = (Id *)arena_alloc(s->arena, max * sizeof(Id))) == NULL)
+            return ERROR;
+        memcpy(aux, s->id, s->n_id * sizeof(Id));
+    }
+    else if ((aux = (Id *)arena_realloc(s->arena, s->id, s->max * sizeof(Id), max * sizeof(Id))) == NULL)
+        return ERROR;
+    s->id = aux;
+    s->max = max;
+
+    /* Half full at most, once the array is full */
+    if (set_index(s, 2 * max) == ERROR)
+        return ERROR;
+
+    return OK;
+}
+
 Set *set_create()
+{
+    return set_create_in(NULL);
+}
+
+Set *set_create_in(Arena *arena)
 {
     Set *set_new;
 
-    set_new = (Set *)calloc(1, sizeof(Set));
+    set_new = (Set *)arena_alloc(arena, sizeof(Set));
     if (!set_new)
         return NULL;
 
-    set_new->id = NULL;
+    set_new->id = set_new->inline_id;
     set_new->n_id = 0;
-    
+    set_new->max = SET_INLINE;
+    set_new->slots = NULL;
+    set_new->n_slots = 0;
+    set_new->arena = arena;
+
     return set_new;
 }
 
+Set *set_copy_in(Arena *arena, Set *s)
+{
+    Set *copy = NULL;
+    int i;
+
+    if (!s || (copy = set_create_in(arena)) == NULL)
+        return NULL;
+
+    for (i = 0; i < s->n_id; i++)
+    {
+        if (set_add(copy, s->id[i]) == ERROR)
+        {
+            set_destroy(copy);
+            return NULL;
+        }
+    }
+
+    return copy;
+}
+
 STATUS set_destroy(Set *s)
 {
     if (s == NULL)
         return ERROR;
 
-    free(s->id);
-    free(s);
+    if (s->id != s->inline_id)
+        arena_free(s->arena, s->id, s->max * sizeof(Id));
+    arena_free(s->arena, s->slots, s->n_slots * sizeof(int));
+    arena_free(s->arena, s, sizeof(Set));
 
     return OK;
 }
 
 STATUS set_add(Set *s, Id id)
 {
-    if (!s || set_contains(s, id) || id == NO_ID)
+    if (!s || id == NO_ID || set_position(s, id) != -1)
+        return ERROR;
+
+    if (set_grow(s) == ERROR)
         return ERROR;
 
+    s->id[s->n_id] = id;
+    if (s->slots)
+        s->slots[set_find(s, id)] = s->n_id;
     s->n_id++;
-    s->id = realloc(s->id, (s->n_id) * sizeof(Id));
-    s->id[s->n_id - 1] = id;
 
     return OK;
 }
 
 STATUS set_del(Set *s, Id id)
 {
-    int i;
+    int i, j, home, mask, pos, last;
 
-    if (!s || s->n_id == 0)
+    if (!s || s->n_id == 0 || id == NO_ID || (pos = set_position(s, id)) == -1)
         return ERROR;
 
-    for (i = 0; i < s->n_id; i++)
+    last = s->n_id - 1;
+    if (s->slots)
     {
-        if (s->id[i] == id)
+        /* Every slot after the hole that would not be found from its home slot is moved into it */
+        i = set_find(s, id);
+        mask = s->n_slots - 1;
+        for (j = (i + 1) & mask; s->slots[j] != -1; j = (j + 1) & mask)
         {
-            s->id[i] = s->id[s->n_id - 1];
-            s->id[s->n_id - 1] = NO_ID;
-            break;
+            home = set_hash(s, s->id[s->slots[j]]);
+            if (((j - home) & mask) >= ((j - i) & mask))
+            {
+                s->slots[i] = s->slots[j];
+                i = j;
+            }
         }
+        s->slots[i] = -1;
+
+        /* The last id goes to the position left */
+        if (pos != last)
+            s->slots[set_find(s, s->id[last])] = pos;
     }
 
+    s->id[pos] = s->id[last];
+    s->id[last] = NO_ID;
     s->n_id--;
 
     return OK;
 }
 
 BOOL set_contains(Set *s, Id id)
+{
+    if (!s || id == NO_ID)
+        return ERROR;
+
+    return (set_position(s, id) != -1) ? TRUE : FALSE;
+}
+
+STATUS set_union(Set *s, Set *other)
 {
     int i;
 
-    if (!s || id == NO_ID)
+    if (!s || !other)
         return ERROR;
 
-    for (i = 0; i < s->n_id; i++)
+    for (i = 0; i < other->n_id; i++)
+    {
+        if (set_position(s, other->id[i]) == -1 && set_add(s, other->id[i]) == ERROR)
+            return ERROR;
+    }
+
+    return OK;
+}
+
+STATUS set_intersect(Set *s, Set *other)
+{
+    int i;
+
+    if (!s || !other)
+        return ERROR;
+
+    /* From the end, the id moved into a hole has already been looked at */
+    for (i = s->n_id - 1; i >= 0; i--)
     {
-        if (s->id[i] == id)
+        if (set_position(other, s->id[i]) == -1)
+            set_del(s, s->id[i]);
+    }
+
+    return OK;
+}
+
+STATUS set_difference(Set *s, Set *other)
+{
+    int i;
+
+    if (!s || !other)
+        return ERROR;
+
+    /* The smaller set is the one gone through */
+    if (other != s && other->n_id < s->n_id)
+    {
+        for (i = 0; i < other->n_id; i++)
+            set_del(s, other->id[i]);
+    }
+    else
+    {
+        for (i = s->n_id - 1; i >= 0; i--)
+        {
+            if (set_position(other, s->id[i]) != -1)
+                set_del(s, s->id[i]);
+        }
+    }
+
+    return OK;
+}
+
+BOOL set_contains_any(Set *s, Set *other)
+{
+    Set *small = NULL, *big = NULL;
+    int i;
+
+    if (!s || !other)
+        return FALSE;
+
+    small = (s->n_id < other->n_id) ? s : other;
+    big = (small == s) ? other : s;
+    for (i = 0; i < small->n_id; i++)
+    {
+        if (set_position(big, small->id[i]) != -1)
             return TRUE;
     }
 
     return FALSE;
 }
 
+int set_foreach(Set *s, set_fn fn, void *data)
+{
+    int i;
+
+    if (!s || !fn)
+        return -1;
+
+    for (i = 0; i < s->n_id; i++)
+    {
+        if (fn(s->id[i], data) == FALSE)
+            return i + 1;
+    }
+
+    return i;
+}
+
 Id *set_get_ids(Set *s)
 {
-    if (!s)
+    /* An empty set has no array of ids to give */
+    if (!s || s->n_id == 0)
         return NULL;
 
     return s->id;
@@ -122,4 +409,4 @@ int set_print(FILE *pf, Set *s)
     }
 
     return n;
-}
\ No newline at end of file
+}
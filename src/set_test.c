@@ -5,7 +5,7 @@
 #include "set_test.h"
 #include "test.h"
 
-#define MAX_TESTS 16
+#define MAX_TESTS 25
 
 /** 
  * @brief Main function for SET unit tests. 
@@ -50,6 +50,15 @@ int main(int argc, char** argv) {
   if (all || test == 14) test2_set_contains();
   if (all || test == 15) test1_set_destroy();
   if (all || test == 16) test2_set_destroy();
+  if (all || test == 17) test1_set_copy_in();
+  if (all || test == 18) test2_set_copy_in();
+  if (all || test == 19) test4_set_add();
+  if (all || test == 20) test4_set_del();
+  if (all || test == 21) test1_set_union();
+  if (all || test == 22) test1_set_intersect();
+  if (all || test == 23) test1_set_difference();
+  if (all || test == 24) test1_set_contains_any();
+  if (all || test == 25) test1_set_foreach();
   
   
   PRINT_PASSED_PERCENTAGE;
@@ -158,4 +167,119 @@ void test1_set_destroy(){
 void test2_set_destroy(){
   Set *s = NULL;
   PRINT_TEST_RESULT(set_destroy(s) == ERROR);
-}
\ No newline at end of file
+}
+
+void test1_set_copy_in(){
+  Set *s, *c;
+  s = set_create();
+  set_add(s,4);
+  set_add(s,5);
+  c = set_copy_in(NULL, s);
+  set_del(s,4);
+  PRINT_TEST_RESULT(set_get_numberofIds(c) == 2 && set_contains(c,4) == TRUE && set_contains(c,5) == TRUE);
+  set_destroy(s);
+  set_destroy(c);
+}
+void test2_set_copy_in(){
+  PRINT_TEST_RESULT(set_copy_in(NULL, NULL) == NULL);
+}
+
+void test4_set_add(){
+  Set *s;
+  Id *ids;
+  int i, ok = 1;
+  s = set_create();
+  for (i = 0; i < 100; i++)
+    set_add(s, 1000 + i);
+  ids = set_get_ids(s);
+  for (i = 0; i < 100; i++)
+    ok = ok && ids[i] == 1000 + i && set_contains(s, 1000 + i) == TRUE;
+  PRINT_TEST_RESULT(ok && set_get_numberofIds(s) == 100 && set_add(s, 1050) == ERROR && set_contains(s, 1100) == FALSE);
+  set_destroy(s);
+}
+
+void test4_set_del(){
+  Set *s;
+  int i;
+  s = set_create();
+  for (i = 0; i < 20; i++)
+    set_add(s, i + 1);
+  set_del(s, 3);
+  PRINT_TEST_RESULT(set_del(s, 3) == ERROR && set_get_numberofIds(s) == 19 && set_get_ids(s)[2] == 20 &&
+                    set_contains(s, 20) == TRUE && set_contains(s, 3) == FALSE);
+  set_destroy(s);
+}
+
+void test1_set_union(){
+  Set *a, *b;
+  int i;
+  a = set_create();
+  b = set_create();
+  for (i = 0; i < 10; i++) {
+    set_add(a, i);
+    set_add(b, i + 5);
+  }
+  PRINT_TEST_RESULT(set_union(a, b) == OK && set_get_numberofIds(a) == 15 && set_contains(a, 14) == TRUE &&
+                    set_get_numberofIds(b) == 10);
+  set_destroy(a);
+  set_destroy(b);
+}
+
+void test1_set_intersect(){
+  Set *a, *b;
+  int i;
+  a = set_create();
+  b = set_create();
+  for (i = 0; i < 10; i++) {
+    set_add(a, i);
+    set_add(b, i + 5);
+  }
+  PRINT_TEST_RESULT(set_intersect(a, b) == OK && set_get_numberofIds(a) == 5 && set_contains(a, 5) == TRUE &&
+                    set_contains(a, 4) == FALSE);
+  set_destroy(a);
+  set_destroy(b);
+}
+
+void test1_set_difference(){
+  Set *a, *b;
+  int i;
+  a = set_create();
+  b = set_create();
+  for (i = 0; i < 10; i++) {
+    set_add(a, i);
+    set_add(b, i + 5);
+  }
+  set_difference(a, b);
+  PRINT_TEST_RESULT(set_get_numberofIds(a) == 5 && set_contains(a, 4) == TRUE && set_contains(a, 5) == FALSE &&
+                    set_difference(b, b) == OK && set_get_numberofIds(b) == 0);
+  set_destroy(a);
+  set_destroy(b);
+}
+
+void test1_set_contains_any(){
+  Set *a, *b;
+  a = set_create();
+  b = set_create();
+  set_add(a, 1);
+  set_add(a, 2);
+  set_add(b, 3);
+  PRINT_TEST_RESULT(set_contains_any(a, b) == FALSE && set_add(b, 2) == OK && set_contains_any(a, b) == TRUE);
+  set_destroy(a);
+  set_destroy(b);
+}
+
+static BOOL test_set_sum(Id id, void *data){
+  *(long *)data += id;
+  return (id != 3) ? TRUE : FALSE;
+}
+
+void test1_set_foreach(){
+  Set *s;
+  long sum = 0;
+  s = set_create();
+  set_add(s, 1);
+  set_add(s, 3);
+  set_add(s, 5);
+  PRINT_TEST_RESULT(set_foreach(s, test_set_sum, &sum) == 2 && sum == 4);
+  set_destroy(s);
+}
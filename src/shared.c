@@ -0,0 +1,282 @@
+/**
+ * @brief It implements a world shared by many games
+ *
+ * A session starts as a copy of the game of the world in which every table
+ * is its own but points to the entities of the world. The player and the
+ * enemies are copied at once, since they change in every session; spaces,
+ * links and objects are copied by game.c when they are first written.
+ * A link is copied together with the space it leaves from, so the exits
+ * of the spaces of a session always lead to the links of the session.
+ *
+ * @file shared.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shared.h"
+
+struct _SharedWorld {
+  Game game;     /*!< The world, which is never played */
+  int sessions;  /*!< Sessions made from it that have not been destroyed */
+  BOOL released; /*!< If who made it gave it up */
+};
+
+/**
+ * @brief Frees the world if no one uses it any more
+ */
+static void shared_free(SharedWorld *world)
+{
+  if (world->released && world->sessions == 0) {
+    game_destroy(&world->game);
+    free(world);
+  }
+}
+
+/**
+ * @brief Frees the tables and the arena of a session
+ */
+static void shared_free_session(Game *game)
+{
+  free(game->spaces);
+  free(game->objects);
+  free(game->links);
+  free(game->enemy);
+  free(game->object_locations);
+  enemy_table_destroy(game->enemy_table);
+  arena_destroy(game->arena);
+}
+
+/**
+ * @brief Allocates the tables and the arena of a session for as many entities as a game has
+ */
+static STATUS shared_alloc_session(Game *game, const Game *from)
+{
+  if ((game->arena = arena_create()) == NULL)
+    return ERROR;
+  game->spaces = (Space **)malloc((from->n_spaces + 1) * sizeof(Space *));
+  game->objects = (Object **)malloc((from->n_objects + 1) * sizeof(Object *));
+  game->links = (Link **)malloc((from->n_links + 1) * sizeof(Link *));
+  game->enemy = (Enemy **)malloc((from->n_enemies + 1) * sizeof(Enemy *));
+  game->object_locations = (Id *)malloc((from->n_objects + 1) * sizeof(Id));
+  game->enemy_table = enemy_table_create_in(game->arena);
+
+  if (!game->spaces || !game->objects || !game->links || !game->enemy || !game->object_locations || !game->enemy_table)
+  {
+    shared_free_session(game);
+    return ERROR;
+  }
+
+  return OK;
+}
+
+/**
+ * @brief Makes a session the same as another game of its world, or as the world itself. The tables,
+ * arena and enemy table of the session must be allocated and empty. Whatever the other game has made its
+ * own is copied, the rest is shared with the world
+ */
+static STATUS shared_fill_session(Game *game, const Game *from, SharedWorld *world)
+{
+  Game *w = &world->game, saved = *game;
+  int i;
+
+  /* The counters, the maps of ids, the art and the rounds are those of the other game */
+  *game = *from;
+  game->arena = saved.arena;
+  game->spaces = saved.spaces;
+  game->objects = saved.objects;
+  game->links = saved.links;
+  game->enemy = saved.enemy;
+  game->object_locations = saved.object_locations;
+  game->enemy_table = saved.enemy_table;
+  game->max_spaces = from->n_spaces + 1;
+  game->max_objects = from->n_objects + 1;
+  game->max_links = from->n_links + 1;
+  game->max_enemies = from->n_enemies + 1;
+  game->shared = world;
+  game->object_names = NULL;
+
+  memcpy(game->spaces, from->spaces, (from->n_spaces + 1) * sizeof(Space *));
+  memcpy(game->objects, from->objects, (from->n_objects + 1) * sizeof(Object *));
+  memcpy(game->links, from->links, (from->n_links + 1) * sizeof(Link *));
+  memcpy(game->object_locations, from->object_locations, from->n_objects * sizeof(Id));
+
+  if (from->play && (game->play = player_copy_in(game->arena, from->play)) == NULL)
+    return ERROR;
+
+  /* Their rows are in the same order, so the map of ids of the world finds them */
+  for (i = 0; i < from->n_enemies; i++) {
+    if ((game->enemy[i] = enemy_copy_in(game->enemy_table, from->enemy[i])) == NULL)
+      return ERROR;
+  }
+  game->enemy[from->n_enemies] = NULL;
+
+  for (i = 0; i < from->n_links; i++) {
+    if (from->links[i] != w->links[i] && (game->links[i] = link_copy_in(game->arena, from->links[i])) == NULL)
+      return ERROR;
+  }
+  /* The spaces need the enemies and the links of the game to be there */
+  for (i = 0; i < from->n_spaces; i++) {
+    if (from->spaces[i] != w->spaces[i] && (game->spaces[i] = shared_copy_space(game, from->spaces[i])) == NULL)
+      return ERROR;
+  }
+  for (i = 0; i < from->n_objects; i++) {
+    if (from->objects[i] != w->objects[i] && (game->objects[i] = object_copy_in(game->arena, from->objects[i])) == NULL)
+      return ERROR;
+  }
+
+  return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+SharedWorld *shared_create(Game *game)
+{
+  SharedWorld *world = NULL;
+
+  if (!game || game->shared || game_finish_load(game, TRUE) == ERROR)
+    return NULL;
+
+  /* Its spaces come and go as it is played */
+  if (game->levels)
+    return NULL;
+
+  if ((world = (SharedWorld *)malloc(sizeof(SharedWorld))) == NULL)
+    return NULL;
+
+  world->game = *game;
+  world->sessions = 0;
+  world->released = FALSE;
+
+  return world;
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+STATUS shared_release(SharedWorld *world)
+{
+  if (!world || world->released)
+    return ERROR;
+
+  world->released = TRUE;
+  shared_free(world);
+
+  return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+STATUS shared_remove_session(SharedWorld *world)
+{
+  if (!world || world->sessions == 0)
+    return ERROR;
+
+  world->sessions--;
+  shared_free(world);
+
+  return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+Game *shared_get_game(SharedWorld *world)
+{
+  if (!world)
+    return NULL;
+
+  return &world->game;
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+int shared_get_sessions(SharedWorld *world)
+{
+  if (!world)
+    return -1;
+
+  return world->sessions;
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+Space *shared_copy_space(Game *game, Space *space)
+{
+  Space *copy = NULL;
+  Enemy *enemy = NULL;
+  Link *link = NULL;
+  int k, n;
+
+  if (!game || (copy = space_copy_in(game->arena, space)) == NULL)
+    return NULL;
+
+  /* Taken from the front and put back at the end, they keep their order */
+  n = space_get_number_of_enemies(copy);
+  for (k = 0; k < n; k++)
+  {
+    enemy = space_get_enemy(copy);
+    space_delete_enemy(copy, enemy);
+    space_add_enemy(copy, game_get_enemy(game, enemy_getId(enemy)));
+  }
+
+  /* Its exits lead to the links of the session, which may be its own copies */
+  for (k = 0; k < 4; k++) {
+    if ((link = space_get_link(copy, N + k)) != NULL)
+      space_set_link(copy, N + k, game_get_link(game, link_getId(link)), space_get_neighbour(copy, N + k));
+  }
+
+  return copy;
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+STATUS game_create_session(Game *game, SharedWorld *world)
+{
+  if (!game || !world)
+    return ERROR;
+
+  if (shared_alloc_session(game, &world->game) == ERROR)
+    return ERROR;
+
+  if (shared_fill_session(game, &world->game, world) == ERROR)
+  {
+    shared_free_session(game);
+    return ERROR;
+  }
+  game->last_cmd = NO_CMD;
+  game->description[0] = '\0';
+
+  world->sessions++;
+
+  return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+STATUS game_clone(Game *clone, const Game *game)
+{
+  if (!clone || !game || !game->shared || clone == game)
+    return ERROR;
+
+  if (shared_alloc_session(clone, game) == ERROR)
+    return ERROR;
+
+  if (shared_fill_session(clone, game, game->shared) == ERROR)
+  {
+    shared_free_session(clone);
+    return ERROR;
+  }
+
+  game->shared->sessions++;
+
+  return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------------*/
+STATUS game_restore(Game *clone, const Game *game)
+{
+  if (!clone || !game || !game->shared || clone == game || clone->shared != game->shared)
+    return ERROR;
+
+  /* Everything the clone made is in its arena, it is all taken back at once */
+  names_destroy(clone->object_names);
+  clone->object_names = NULL;
+  enemy_table_clear(clone->enemy_table);
+  arena_clear(clone->arena);
+
+  return shared_fill_session(clone, game, game->shared);
+}
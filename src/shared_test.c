@@ -0,0 +1,269 @@
+/** 
+ * @brief It tests the shared world module
+ * 
+ * @file shared_test.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+#include "game_reader.h"
+#include "shared.h"
+#include "shared_test.h"
+#include "test.h"
+
+#define MAX_TESTS 14
+#define WORLD_FILE "shared_test.tmp"
+
+/** 
+ * @brief Writes a data file with two rooms, a sword in the first one, a boss in the second one and a
+ * closed door between them that opens when the boss is dead
+ */
+static void write_world_file() {
+  FILE *f = fopen(WORLD_FILE, "w");
+  fprintf(f, "#s:11|Hall|1|\nhall\n");
+  fprintf(f, "#s:12|Cave|1|\ncave\n");
+  fprintf(f, "#o:21|Sword|11|1|1|0.5|-1|0|0|0|0|\n");
+  fprintf(f, "#p:1|ant|11|25|5|1|0|2|1|\n");
+  fprintf(f, "#e:41|Boss|12|10|1|0|1|1|\n");
+  fprintf(f, "#l:31|Door|11|12|1|0|41|\n");
+  fprintf(f, "#l:32|Back|12|11|2|1|-1|\n");
+  fclose(f);
+}
+
+/** 
+ * @brief Loads the data file and makes it a shared world
+ */
+static SharedWorld *make_world() {
+  Game game;
+  if (game_create_from_file_mode(&game, WORLD_FILE, LOAD_STREAM) == ERROR)
+    return NULL;
+  return shared_create(&game);
+}
+
+/** 
+ * @brief Takes the sword, kills the boss and opens the door in a session
+ */
+static void play(Game *game) {
+  Enemy *boss = game_get_enemy(game, 41);
+  game_set_object_location(game, 21, CARRIED);
+  enemy_setHealth(boss, 0);
+  game_set_enemy_location(game, boss, DEAD);
+  game_set_link_open(game, 31, TRUE);
+}
+
+/** 
+ * @brief Main function for SHARED unit tests. 
+ * 
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed 
+ *   2.- A number means a particular test (the one identified by that number) 
+ *       is executed
+ *  
+ */
+int main(int argc, char** argv) {
+
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2) {
+    printf("Running all test for module Shared:\n");
+  } else {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS) {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  write_world_file();
+
+  if (all || test == 1) test1_shared_create();
+  if (all || test == 2) test2_shared_create();
+  if (all || test == 3) test1_game_create_session();
+  if (all || test == 4) test2_game_create_session();
+  if (all || test == 5) test3_game_create_session();
+  if (all || test == 6) test4_game_create_session();
+  if (all || test == 7) test5_game_create_session();
+  if (all || test == 8) test1_game_clone();
+  if (all || test == 9) test2_game_clone();
+  if (all || test == 10) test1_game_restore();
+  if (all || test == 11) test2_game_restore();
+  if (all || test == 12) test1_shared_remove_session();
+  if (all || test == 13) test1_shared_release();
+  if (all || test == 14) test2_shared_release();
+
+  remove(WORLD_FILE);
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_shared_create() {
+  SharedWorld *w;
+  w = make_world();
+  PRINT_TEST_RESULT(w != NULL && shared_get_sessions(w) == 0 && game_get_space(shared_get_game(w), 11) != NULL);
+  shared_release(w);
+}
+
+void test2_shared_create() {
+  PRINT_TEST_RESULT(shared_create(NULL) == NULL);
+}
+
+void test1_game_create_session() {
+  SharedWorld *w;
+  Game a;
+  w = make_world();
+  game_create_session(&a, w);
+  PRINT_TEST_RESULT(shared_get_sessions(w) == 1 && game_get_player_location(&a) == 11 &&
+                    game_get_space(&a, 11) == game_get_space(shared_get_game(w), 11));
+  game_destroy(&a);
+  shared_release(w);
+}
+
+void test2_game_create_session() {
+  Game a;
+  PRINT_TEST_RESULT(game_create_session(&a, NULL) == ERROR);
+}
+
+void test3_game_create_session() {
+  SharedWorld *w;
+  Game a, b;
+  w = make_world();
+  game_create_session(&a, w);
+  game_create_session(&b, w);
+  game_set_object_location(&a, 21, CARRIED);
+  PRINT_TEST_RESULT(player_hasObject(a.play, 21) == TRUE && player_hasObject(b.play, 21) == FALSE &&
+                    game_get_object_location(&b, 21) == 11 && space_has_object(game_get_space(&b, 11), 21) == TRUE &&
+                    space_has_object(game_get_space(shared_get_game(w), 11), 21) == TRUE);
+  game_destroy(&a);
+  game_destroy(&b);
+  shared_release(w);
+}
+
+void test4_game_create_session() {
+  SharedWorld *w;
+  Game a, b;
+  w = make_world();
+  game_create_session(&a, w);
+  game_create_session(&b, w);
+  game_set_link_open(&a, 31, TRUE);
+  PRINT_TEST_RESULT(link_getOpen(space_get_link(game_get_space(&a, 11), N)) == TRUE &&
+                    link_getOpen(space_get_link(game_get_space(&b, 11), N)) == FALSE &&
+                    link_getOpen(game_get_link(shared_get_game(w), 31)) == FALSE);
+  game_destroy(&a);
+  game_destroy(&b);
+  shared_release(w);
+}
+
+void test5_game_create_session() {
+  SharedWorld *w;
+  Game a, b;
+  Enemy *boss;
+  w = make_world();
+  game_create_session(&a, w);
+  game_create_session(&b, w);
+  boss = game_get_enemy(&a, 41);
+  enemy_setHealth(boss, 0);
+  game_set_enemy_location(&a, boss, DEAD);
+  PRINT_TEST_RESULT(space_get_number_of_enemies(game_get_space(&a, 12)) == 0 &&
+                    enemy_getHealth(game_get_enemy(&b, 41)) == 10 && enemy_getLocation(game_get_enemy(&b, 41)) == 12 &&
+                    space_get_number_of_enemies(game_get_space(&b, 12)) == 1 &&
+                    enemy_getHealth(game_get_enemy(shared_get_game(w), 41)) == 10);
+  game_destroy(&a);
+  game_destroy(&b);
+  shared_release(w);
+}
+
+void test1_game_clone() {
+  SharedWorld *w;
+  Game a, c;
+  w = make_world();
+  game_create_session(&a, w);
+  play(&a);
+  game_clone(&c, &a);
+  PRINT_TEST_RESULT(shared_get_sessions(w) == 2 && player_hasObject(c.play, 21) == TRUE &&
+                    enemy_getLocation(game_get_enemy(&c, 41)) == DEAD &&
+                    link_getOpen(space_get_link(game_get_space(&c, 11), N)) == TRUE &&
+                    game_get_link(&c, 31) != game_get_link(&a, 31) && game_get_space(&c, 12) != game_get_space(&a, 12));
+  game_destroy(&c);
+  game_destroy(&a);
+  shared_release(w);
+}
+
+void test2_game_clone() {
+  SharedWorld *w;
+  Game c;
+  w = make_world();
+  PRINT_TEST_RESULT(game_clone(&c, shared_get_game(w)) == ERROR && shared_get_sessions(w) == 0);
+  shared_release(w);
+}
+
+void test1_game_restore() {
+  SharedWorld *w;
+  Game a, c;
+  w = make_world();
+  game_create_session(&a, w);
+  play(&a);
+  game_clone(&c, &a);
+  game_set_object_location(&c, 21, 12);
+  game_set_link_open(&c, 31, FALSE);
+  player_setHealth(c.play, 1);
+  PRINT_TEST_RESULT(game_restore(&c, &a) == OK && player_hasObject(c.play, 21) == TRUE &&
+                    space_has_object(game_get_space(&c, 12), 21) == FALSE &&
+                    link_getOpen(space_get_link(game_get_space(&c, 11), N)) == TRUE &&
+                    player_getHealth(c.play) == player_getHealth(a.play));
+  game_destroy(&c);
+  game_destroy(&a);
+  shared_release(w);
+}
+
+void test2_game_restore() {
+  SharedWorld *w;
+  Game a, c;
+  w = make_world();
+  game_create_session(&a, w);
+  play(&a);
+  game_clone(&c, &a);
+  game_set_object_location(&c, 21, 12);
+  game_set_link_open(&c, 31, FALSE);
+  PRINT_TEST_RESULT(player_hasObject(a.play, 21) == TRUE && space_has_object(game_get_space(&a, 12), 21) == FALSE &&
+                    link_getOpen(space_get_link(game_get_space(&a, 11), N)) == TRUE);
+  game_destroy(&c);
+  game_destroy(&a);
+  shared_release(w);
+}
+
+void test1_shared_remove_session() {
+  SharedWorld *w;
+  Game a, b;
+  w = make_world();
+  game_create_session(&a, w);
+  game_create_session(&b, w);
+  game_destroy(&a);
+  PRINT_TEST_RESULT(shared_get_sessions(w) == 1);
+  game_destroy(&b);
+  shared_release(w);
+}
+
+void test1_shared_release() {
+  SharedWorld *w;
+  Game a;
+  w = make_world();
+  game_create_session(&a, w);
+  PRINT_TEST_RESULT(shared_release(w) == OK && shared_get_sessions(w) == 1 && game_get_space(&a, 12) != NULL);
+  game_destroy(&a);
+}
+
+void test2_shared_release() {
+  SharedWorld *w;
+  w = make_world();
+  shared_release(w);
+  PRINT_TEST_RESULT(shared_release(NULL) == ERROR);
+}
@@ -20,40 +20,118 @@
  */
 struct _Space {
   Id id;                    /*!< Id number of the space, it must be unique */
-  char name[WORD_SIZE + 1]; /*!< Name of the space */
+  StrId name;               /*!< Name of the space, in the table of the program */
   Id north;                 /*!< Id of the space at the north */
   Id south;                 /*!< Id of the space at the south */
   Id east;                  /*!< Id of the space at the east */
   Id west;                  /*!< Id of the space at the west */
+  Link *links[4];           /*!< Links to the north, south, east and west, resolved from the ids after the load */
+  Space *neighbours[4];     /*!< Spaces those links lead to */
   Set *objects;             /*!< Object for the space */
-  char gdesc[5][10];        /*!< Graphic description of the space*/
-  char description[235]; /*!< Description of the object */
+  Enemy **enemies;          /*!< Enemies in the space, in the order they came in */
+  int n_enemies;            /*!< Number of enemies in the space */
+  Arena *arena;             /*!< Arena the space comes from, NULL if it is in the heap */
+  int nlines;               /*!< Number of lines of the graphic description */
+  ArtStore *art;            /*!< Store the graphic description is read from, NULL if it is in gdesc */
+  int art_id;               /*!< Number of the graphic description in the store */
+  StrId *gdesc;             /*!< Lines of the graphic description in the table of the program, when there is no store */
+  int max_gdesc;            /*!< Allocated size of gdesc */
+  StrId description;        /*!< Description of the space, in the table of the program */
 };
 
 /** space_create allocates memory for a new space
   *  and initializes its members
   */
 Space* space_create(Id id) {
+  return space_create_in(NULL, id);
+}
+
+/** space_create_in does the same taking the memory from an arena
+  */
+Space* space_create_in(Arena *arena, Id id) {
   Space *newSpace = NULL;
+  int i;
 
   /* Error control */
   if (id == NO_ID)
     return NULL;
 
-  newSpace = (Space *) malloc(sizeof (Space));
+  newSpace = (Space *) arena_alloc(arena, sizeof (Space));
   if (newSpace == NULL) {
     return NULL;
   }
 
   /* Initialization of an empty space*/
   newSpace->id = id;
-  newSpace->name[0] = '\0';
+  newSpace->name = NO_STR;
   newSpace->north = NO_ID;
   newSpace->south = NO_ID;
   newSpace->east = NO_ID;
   newSpace->west = NO_ID;
-  newSpace->description[0] = '\0';
-  newSpace->objects = set_create();
+  for (i = 0; i < 4; i++) {
+    newSpace->links[i] = NULL;
+    newSpace->neighbours[i] = NULL;
+  }
+  newSpace->description = NO_STR;
+  newSpace->nlines = 0;
+  newSpace->art = NULL;
+  newSpace->art_id = -1;
+  newSpace->gdesc = NULL;
+  newSpace->max_gdesc = 0;
+  newSpace->objects = set_create_in(arena);
+  newSpace->enemies = NULL;
+  newSpace->n_enemies = 0;
+  newSpace->arena = arena;
+
+  return newSpace;
+}
+
+/** space_copy_in makes a space equal to another one, with its own
+  *  objects and enemies, taking the memory from an arena
+  */
+Space* space_copy_in(Arena *arena, Space *space) {
+  Space *newSpace = NULL;
+
+  if (!space) {
+    return NULL;
+  }
+
+  newSpace = (Space *) arena_alloc(arena, sizeof (Space));
+  if (newSpace == NULL) {
+    return NULL;
+  }
+
+  *newSpace = *space;
+  newSpace->arena = arena;
+  newSpace->enemies = NULL;
+  newSpace->gdesc = NULL;
+  newSpace->max_gdesc = 0;
+  if ((newSpace->objects = set_copy_in(arena, space->objects)) == NULL) {
+    arena_free(arena, newSpace, sizeof (Space));
+    return NULL;
+  }
+
+  if (space->max_gdesc > 0) {
+    newSpace->gdesc = (StrId *) arena_alloc(arena, space->max_gdesc * sizeof(StrId));
+    if (newSpace->gdesc == NULL) {
+      set_destroy(newSpace->objects);
+      arena_free(arena, newSpace, sizeof (Space));
+      return NULL;
+    }
+    memcpy(newSpace->gdesc, space->gdesc, space->max_gdesc * sizeof(StrId));
+    newSpace->max_gdesc = space->max_gdesc;
+  }
+
+  if (space->n_enemies > 0) {
+    newSpace->enemies = (Enemy **) arena_alloc(arena, space->n_enemies * sizeof(Enemy *));
+    if (newSpace->enemies == NULL) {
+      set_destroy(newSpace->objects);
+      arena_free(arena, newSpace->gdesc, newSpace->max_gdesc * sizeof(StrId));
+      arena_free(arena, newSpace, sizeof (Space));
+      return NULL;
+    }
+    memcpy(newSpace->enemies, space->enemies, space->n_enemies * sizeof(Enemy *));
+  }
 
   return newSpace;
 }
@@ -67,7 +145,9 @@ STATUS space_destroy(Space* space) {
   }
 
   set_destroy(space->objects);
-  free(space);
+  arena_free(space->arena, space->enemies, space->n_enemies * sizeof(Enemy *));
+  arena_free(space->arena, space->gdesc, space->max_gdesc * sizeof(StrId));
+  arena_free(space->arena, space, sizeof(Space));
   space = NULL;
   return OK;
 }
@@ -84,13 +164,16 @@ Id space_get_id(Space* space) {
 /** It sets the name of a space
   */
 STATUS space_set_name(Space* space, char* name) {
+  StrId id;
+
   if (!space || !name) {
     return ERROR;
   }
 
-  if (!strcpy(space->name, name)) {
+  if ((id = strtab_id(name)) == NO_STR && name[0]) {
     return ERROR;
   }
+  space->name = id;
   return OK;
 }
 
@@ -100,16 +183,31 @@ const char * space_get_name(Space* space) {
   if (!space) {
     return NULL;
   }
+  return strtab_str(space->name);
+}
+
+/** It gets the handle of the name of a space
+  */
+StrId space_get_name_id(Space* space) {
+  if (!space) {
+    return NO_STR;
+  }
   return space->name;
 }
 
 /** It sets the description of a space
   */
 STATUS space_set_desc(Space* space, char *desc) {
+  StrId id;
+
   if (!space || !desc) {
     return ERROR;
   }
-  strcpy(space->description, desc);
+
+  if ((id = strtab_id(desc)) == NO_STR && desc[0]) {
+    return ERROR;
+  }
+  space->description = id;
   return OK;
 }
 
@@ -121,7 +219,7 @@ char *space_get_desc(Space* space) {
   if (!space) {
     return NULL;
   }
-  return space->description;
+  return (char *) strtab_str(space->description);
 }
 
 /** It sets the id of the space located at the north
@@ -131,6 +229,8 @@ STATUS space_set_north(Space* space, Id id) {
     return ERROR;
   }
   space->north = id;
+  space->links[0] = NULL;
+  space->neighbours[0] = NULL;
   return OK;
 }
 
@@ -150,6 +250,8 @@ STATUS space_set_south(Space* space, Id id) {
     return ERROR;
   }
   space->south = id;
+  space->links[1] = NULL;
+  space->neighbours[1] = NULL;
   return OK;
 }
 /** It gets the id of the space located at the south
@@ -168,6 +270,8 @@ STATUS space_set_east(Space* space, Id id) {
     return ERROR;
   }
   space->east = id;
+  space->links[2] = NULL;
+  space->neighbours[2] = NULL;
   return OK;
 }
 /** It gets the id of the space located at the east
@@ -186,6 +290,8 @@ STATUS space_set_west(Space* space, Id id) {
     return ERROR;
   }
   space->west = id;
+  space->links[3] = NULL;
+  space->neighbours[3] = NULL;
   return OK;
 }
 /** It gets the id of the space located at the west
@@ -197,6 +303,35 @@ Id space_get_west(Space* space) {
   return space->west;
 }
 
+/** It sets the link of a space in a direction and the space it leads to
+  */
+STATUS space_set_link(Space* space, DIRECTION dir, Link *link, Space *neighbour) {
+  if (!space || dir < N || dir > W) {
+    return ERROR;
+  }
+  space->links[dir - N] = link;
+  space->neighbours[dir - N] = neighbour;
+  return OK;
+}
+
+/** It gets the link of a space in a direction
+  */
+Link *space_get_link(Space* space, DIRECTION dir) {
+  if (!space || dir < N || dir > W) {
+    return NULL;
+  }
+  return space->links[dir - N];
+}
+
+/** It gets the space the link of a space in a direction leads to
+  */
+Space *space_get_neighbour(Space* space, DIRECTION dir) {
+  if (!space || dir < N || dir > W) {
+    return NULL;
+  }
+  return space->neighbours[dir - N];
+}
+
 /*It adds a new object*/
 STATUS space_add_object(Space* space, Id id) {
   if (!space) {
@@ -244,12 +379,95 @@ Set *space_get_set(Space *space) {
   return space->objects;
 }
 
+/*It puts an enemy in the space*/
+STATUS space_add_enemy(Space *space, Enemy *enemy) {
+  Enemy **aux = NULL;
+  int i;
+
+  if (!space || !enemy) {
+    return ERROR;
+  }
+
+  for (i = 0; i < space->n_enemies; i++) {
+    if (space->enemies[i] == enemy) {
+      return ERROR;
+    }
+  }
+
+  aux = (Enemy **) arena_realloc(space->arena, space->enemies, space->n_enemies * sizeof(Enemy *),
+                                 (space->n_enemies + 1) * sizeof(Enemy *));
+  if (!aux) {
+    return ERROR;
+  }
+  space->enemies = aux;
+  space->enemies[space->n_enemies++] = enemy;
+
+  return OK;
+}
+
+/*It takes an enemy out of the space*/
+STATUS space_delete_enemy(Space *space, Enemy *enemy) {
+  int i;
+
+  if (!space || !enemy) {
+    return ERROR;
+  }
+
+  for (i = 0; i < space->n_enemies; i++) {
+    if (space->enemies[i] == enemy) {
+      memmove(&space->enemies[i], &space->enemies[i + 1], (space->n_enemies - i - 1) * sizeof(Enemy *));
+      space->n_enemies--;
+      return OK;
+    }
+  }
+
+  return ERROR;
+}
+
+/*It gets the first enemy in the space*/
+Enemy *space_get_enemy(Space *space) {
+  return space_get_enemy_at(space, 0);
+}
+
+/*It gets the enemy at a position*/
+Enemy *space_get_enemy_at(Space *space, int i) {
+  if (!space || i < 0 || i >= space->n_enemies) {
+    return NULL;
+  }
+
+  return space->enemies[i];
+}
+
+/*It gets the number of enemies*/
+int space_get_number_of_enemies(Space *space) {
+  if (!space) {
+    return -1;
+  }
+
+  return space->n_enemies;
+}
+
 STATUS space_set_gdesc(Space *space, char *gdesc, int i)
 {
-  if(!space || !gdesc || (i < 0) || (i >= GDESC))
+  StrId *aux = NULL;
+  int max;
+
+  if(!space || !gdesc || (i < 0))
     return ERROR;
-  
-  if(strcpy(space->gdesc[i], gdesc) == ERROR)
+
+  /* Room for every line the space says it has, the lines not set yet are empty */
+  if(i >= space->max_gdesc)
+  {
+    max = (i < space->nlines) ? space->nlines : i + 1;
+    aux = (StrId *) arena_realloc(space->arena, space->gdesc, space->max_gdesc * sizeof(StrId), max * sizeof(StrId));
+    if(!aux)
+      return ERROR;
+    memset(aux + space->max_gdesc, 0, (max - space->max_gdesc) * sizeof(StrId));
+    space->gdesc = aux;
+    space->max_gdesc = max;
+  }
+
+  if((space->gdesc[i] = strtab_id(gdesc)) == NO_STR && gdesc[0])
     return ERROR;
 
   return OK;
@@ -257,10 +475,54 @@ STATUS space_set_gdesc(Space *space, char *gdesc, int i)
 
 const char * space_get_gdesc(Space *space, int i)
 {
-  if(!space || (i < 0) || (i > GDESC))
+  if(space && space->art)
+    return art_get_line(space->art, space->art_id, i);
+
+  if(!space || (i < 0) || (i >= space->nlines))
+    return NULL;
+
+  if(i >= space->max_gdesc)
+    return "";
+
+  return strtab_str(space->gdesc[i]);
+}
+
+STATUS space_set_art(Space *space, ArtStore *store, int art)
+{
+  if(!space || !store || (art < 0))
+    return ERROR;
+
+  space->art = store;
+  space->art_id = art;
+  space->nlines = art_get_nlines(store, art);
+
+  return OK;
+}
+
+int space_get_art(Space *space)
+{
+  if(!space || !space->art)
+    return -1;
+
+  return space->art_id;
+}
+
+STATUS space_set_nlines(Space *space, int nlines)
+{
+  if(!space || (nlines < 0))
     return ERROR;
 
-  return space->gdesc[i];
+  space->nlines = nlines;
+
+  return OK;
+}
+
+int space_get_nlines(Space *space)
+{
+  if(!space)
+    return -1;
+
+  return space->nlines;
 }
 
 
@@ -275,7 +537,7 @@ STATUS space_print(Space* space) {
   }
 
   /* 1. Print the id and the name of the space */
-  fprintf(stdout, "--> Space (Id: %ld; Name: %s)\n", space->id, space->name);
+  fprintf(stdout, "--> Space (Id: %ld; Name: %s)\n", space->id, strtab_str(space->name));
  
   /* 2. For each direction, print its link */ 
   idaux = space_get_north(space);
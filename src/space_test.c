@@ -15,7 +15,7 @@
 #include "space_test.h"
 #include "test.h"
 
-#define MAX_TESTS 36
+#define MAX_TESTS 45
 
 /** 
  * @brief Main function for SPACE unit tests. 
@@ -80,6 +80,15 @@ int main(int argc, char** argv) {
   if (all || test == 34) test1_space_delete_object();
   if (all || test == 35) test2_space_delete_object();
   if (all || test == 36) test3_space_delete_object();
+  if (all || test == 37) test1_space_get_link();
+  if (all || test == 38) test2_space_get_link();
+  if (all || test == 39) test3_space_get_link();
+  if (all || test == 40) test1_space_add_enemy();
+  if (all || test == 41) test2_space_add_enemy();
+  if (all || test == 42) test1_space_delete_enemy();
+  if (all || test == 43) test1_space_copy_in();
+  if (all || test == 44) test1_space_set_gdesc();
+  if (all || test == 45) test2_space_set_gdesc();
 
   PRINT_PASSED_PERCENTAGE;
 
@@ -316,4 +325,124 @@ void test2_space_delete_object() {
 void test3_space_delete_object() {
   Space *s = NULL;
   PRINT_TEST_RESULT(space_delete_object(s, 21) == ERROR);
-}
\ No newline at end of file
+}
+
+void test1_space_get_link() {
+  Space *s = NULL, *t = NULL;
+  Link *l = NULL;
+  s = space_create(1);
+  t = space_create(2);
+  l = link_create();
+  space_set_north(s, 5);
+  space_set_link(s, N, l, t);
+  PRINT_TEST_RESULT(space_get_link(s, N) == l && space_get_neighbour(s, N) == t && space_get_link(s, S) == NULL);
+  link_destroy(l);
+  space_destroy(t);
+  space_destroy(s);
+}
+
+void test2_space_get_link() {
+  Space *s = NULL, *t = NULL;
+  Link *l = NULL;
+  s = space_create(1);
+  t = space_create(2);
+  l = link_create();
+  space_set_link(s, E, l, t);
+  space_set_east(s, 6);
+  PRINT_TEST_RESULT(space_get_link(s, E) == NULL && space_get_neighbour(s, E) == NULL);
+  link_destroy(l);
+  space_destroy(t);
+  space_destroy(s);
+}
+
+void test3_space_get_link() {
+  Space *s = NULL;
+  PRINT_TEST_RESULT(space_get_link(s, N) == NULL);
+}
+
+void test1_space_add_enemy() {
+  Space *s = NULL;
+  Enemy *e = NULL, *f = NULL;
+  s = space_create(1);
+  e = enemy_create();
+  f = enemy_create();
+  space_add_enemy(s, e);
+  space_add_enemy(s, f);
+  PRINT_TEST_RESULT(space_get_number_of_enemies(s) == 2 && space_get_enemy(s) == e && space_get_enemy_at(s, 1) == f);
+  enemy_destroy(f);
+  enemy_destroy(e);
+  space_destroy(s);
+}
+
+void test2_space_add_enemy() {
+  Space *s = NULL;
+  Enemy *e = NULL;
+  s = space_create(1);
+  e = enemy_create();
+  space_add_enemy(s, e);
+  PRINT_TEST_RESULT(space_add_enemy(s, e) == ERROR && space_get_number_of_enemies(s) == 1);
+  enemy_destroy(e);
+  space_destroy(s);
+}
+
+void test1_space_delete_enemy() {
+  Space *s = NULL;
+  Enemy *e = NULL, *f = NULL;
+  s = space_create(1);
+  e = enemy_create();
+  f = enemy_create();
+  space_add_enemy(s, e);
+  space_add_enemy(s, f);
+  space_delete_enemy(s, e);
+  PRINT_TEST_RESULT(space_get_enemy(s) == f && space_delete_enemy(s, e) == ERROR && space_get_enemy(NULL) == NULL);
+  enemy_destroy(f);
+  enemy_destroy(e);
+  space_destroy(s);
+}
+
+void test1_space_copy_in() {
+  Space *s = NULL, *c = NULL;
+  Enemy *e = NULL;
+  s = space_create(1);
+  e = enemy_create();
+  space_set_name(s, "hall");
+  space_add_object(s, 7);
+  space_add_enemy(s, e);
+  c = space_copy_in(NULL, s);
+  space_delete_object(c, 7);
+  space_delete_enemy(c, e);
+  PRINT_TEST_RESULT(strcmp(space_get_name(c), "hall") == 0 && space_has_object(s, 7) == TRUE &&
+                    space_get_enemy(s) == e && space_get_enemy(c) == NULL);
+  enemy_destroy(e);
+  space_destroy(c);
+  space_destroy(s);
+}
+
+void test1_space_set_gdesc() {
+  Space *s = NULL, *t = NULL;
+  char line[100];
+  int i;
+  s = space_create(1);
+  t = space_create(2);
+  space_set_nlines(s, 27);
+  space_set_nlines(t, 27);
+  for (i = 0; i < 27; i++) {
+    sprintf(line, "%-80s%d", "|  corridor  |", i % 3);
+    space_set_gdesc(s, line, i);
+    space_set_gdesc(t, line, i);
+  }
+  PRINT_TEST_RESULT(strlen(space_get_gdesc(s, 26)) == 81 && space_get_gdesc(s, 26) == space_get_gdesc(t, 26) &&
+                    space_get_gdesc(s, 3) == space_get_gdesc(s, 0));
+  space_destroy(s);
+  space_destroy(t);
+}
+
+void test2_space_set_gdesc() {
+  Space *s = NULL;
+  s = space_create(1);
+  space_set_nlines(s, 3);
+  space_set_gdesc(s, "top", 0);
+  PRINT_TEST_RESULT(strcmp(space_get_gdesc(s, 2), "") == 0 && space_get_gdesc(s, 3) == NULL &&
+                    space_set_gdesc(s, "x", -1) == ERROR);
+  space_destroy(s);
+}
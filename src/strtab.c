@@ -0,0 +1,262 @@
+/**
+ * @brief Implements the string table module
+ *
+ * Strings are kept in large character blocks that are never moved, so the
+ * pointers handed out stay valid. They are found through an open addressing
+ * hash table that doubles when it gets half full.
+ *
+ * The table of the program keeps, besides, the string of every handle in
+ * pages of STRTAB_PAGE pointers that never move, so strtab_str reads them
+ * without the lock that strtab_id takes.
+ *
+ * @file strtab.c
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "strtab.h"
+
+#define STRTAB_BLOCK 16384
+#define STRTAB_SLOTS 256
+#define STRTAB_PAGE 4096  /* handles in a page of the table of the program */
+#define STRTAB_PAGES 4096 /* pages of the table of the program, for 16M strings */
+
+/**
+ * @brief Block of characters where the strings are stored
+ */
+typedef struct _StrBlock {
+    struct _StrBlock *next; /*Previous block*/
+    int used;               /*Characters used*/
+    int size;               /*Characters available*/
+    char data[];            /*Strings, NUL terminated*/
+} StrBlock;
+
+/**
+ * @brief Slot of the hash table
+ */
+typedef struct {
+    const char *str;    /*Interned string, NULL if the slot is free*/
+    int len;            /*Length of the string*/
+    unsigned int hash;  /*Hash of the string*/
+    StrId id;           /*Handle in the table of the program, NO_STR in other tables*/
+} StrSlot;
+
+struct _StrTab
+{
+    StrSlot *slots;   /*Hash table*/
+    int n_slots;      /*Size of the hash table, power of two*/
+    int n_str;        /*Number of strings*/
+    StrBlock *blocks; /*Storage, last block first*/
+};
+
+static StrTab *strtab_program = NULL;                     /* table of the program, made when first used */
+static const char **strtab_pages[STRTAB_PAGES];           /* string of every handle */
+static StrId strtab_next = 1;                             /* next handle, 0 is the empty string */
+static pthread_mutex_t strtab_lock = PTHREAD_MUTEX_INITIALIZER; /* protects all of the above but the reads of pages */
+
+/*----------------------------------------------------------------------------------------------------*/
+static unsigned int strtab_hash(const char *s, int len)
+{
+    unsigned int h = 2166136261u;
+    int i;
+
+    for (i = 0; i < len; i++)
+    {
+        h ^= (unsigned char)s[i];
+        h *= 16777619u;
+    }
+
+    return h;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+static char *strtab_store(StrTab *t, const char *s, int len)
+{
+    StrBlock *b = t->blocks;
+    int size;
+    char *dst;
+
+    if (!b || b->size - b->used < len + 1)
+    {
+        size = (len + 1 > STRTAB_BLOCK) ? len + 1 : STRTAB_BLOCK;
+        b = (StrBlock *)malloc(sizeof(StrBlock) + size);
+        if (!b)
+            return NULL;
+        b->next = t->blocks;
+        b->used = 0;
+        b->size = size;
+        t->blocks = b;
+    }
+
+    dst = b->data + b->used;
+    memcpy(dst, s, len);
+    dst[len] = '\0';
+    b->used += len + 1;
+
+    return dst;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+static STATUS strtab_grow(StrTab *t)
+{
+    StrSlot *old = t->slots, *slots;
+    int n = t->n_slots * 2, i, k;
+
+    slots = (StrSlot *)calloc(n, sizeof(StrSlot));
+    if (!slots)
+        return ERROR;
+
+    for (i = 0; i < t->n_slots; i++)
+    {
+        if (!old[i].str)
+            continue;
+        k = old[i].hash & (n - 1);
+        while (slots[k].str)
+            k = (k + 1) & (n - 1);
+        slots[k] = old[i];
+    }
+
+    free(old);
+    t->slots = slots;
+    t->n_slots = n;
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+StrTab *strtab_create()
+{
+    StrTab *t;
+
+    t = (StrTab *)calloc(1, sizeof(StrTab));
+    if (!t)
+        return NULL;
+
+    t->slots = (StrSlot *)calloc(STRTAB_SLOTS, sizeof(StrSlot));
+    if (!t->slots)
+    {
+        free(t);
+        return NULL;
+    }
+    t->n_slots = STRTAB_SLOTS;
+
+    return t;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+STATUS strtab_destroy(StrTab *t)
+{
+    StrBlock *b, *next;
+
+    if (!t)
+        return ERROR;
+
+    for (b = t->blocks; b; b = next)
+    {
+        next = b->next;
+        free(b);
+    }
+    free(t->slots);
+    free(t);
+
+    return OK;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Gives the slot of a string, storing it in a new one if it was not there
+ */
+static StrSlot *strtab_slot(StrTab *t, const char *s, int len)
+{
+    unsigned int h;
+    int k;
+
+    if (2 * (t->n_str + 1) > t->n_slots && strtab_grow(t) == ERROR)
+        return NULL;
+
+    h = strtab_hash(s, len);
+    k = h & (t->n_slots - 1);
+    while (t->slots[k].str)
+    {
+        if (t->slots[k].hash == h && t->slots[k].len == len && memcmp(t->slots[k].str, s, len) == 0)
+            return &t->slots[k];
+        k = (k + 1) & (t->n_slots - 1);
+    }
+
+    if (!(t->slots[k].str = strtab_store(t, s, len)))
+        return NULL;
+    t->slots[k].len = len;
+    t->slots[k].hash = h;
+    t->slots[k].id = NO_STR;
+    t->n_str++;
+
+    return &t->slots[k];
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+const char *strtab_intern(StrTab *t, const char *s, int len)
+{
+    StrSlot *slot;
+
+    if (!t || !s || len < 0 || (slot = strtab_slot(t, s, len)) == NULL)
+        return NULL;
+
+    return slot->str;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+int strtab_get_number(StrTab *t)
+{
+    if (!t)
+        return -1;
+
+    return t->n_str;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+StrId strtab_id(const char *s)
+{
+    StrSlot *slot = NULL;
+    StrId id = NO_STR;
+    int page;
+
+    if (!s || !s[0])
+        return NO_STR;
+
+    pthread_mutex_lock(&strtab_lock);
+    if (!strtab_program)
+        strtab_program = strtab_create();
+    if (strtab_program && (slot = strtab_slot(strtab_program, s, strlen(s))) != NULL)
+    {
+        if (slot->id == NO_STR)
+        {
+            /* The string is left in the table without a handle if its page cannot be made */
+            page = strtab_next / STRTAB_PAGE;
+            if (page < STRTAB_PAGES && !strtab_pages[page])
+                strtab_pages[page] = (const char **)malloc(STRTAB_PAGE * sizeof(const char *));
+            if (page < STRTAB_PAGES && strtab_pages[page])
+            {
+                strtab_pages[page][strtab_next % STRTAB_PAGE] = slot->str;
+                slot->id = strtab_next++;
+            }
+        }
+        id = slot->id;
+    }
+    pthread_mutex_unlock(&strtab_lock);
+
+    return id;
+}
+
+/*----------------------------------------------------------------------------------------------------*/
+const char *strtab_str(StrId id)
+{
+    /* The page of a handle given out is never changed again */
+    if (id == NO_STR || id / STRTAB_PAGE >= STRTAB_PAGES || !strtab_pages[id / STRTAB_PAGE])
+        return "";
+
+    return strtab_pages[id / STRTAB_PAGE][id % STRTAB_PAGE];
+}
@@ -0,0 +1,158 @@
+/** 
+ * @brief It tests the string table module
+ * 
+ * @file strtab_test.c
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h> 
+#include <stdlib.h> 
+#include <string.h> 
+#include "strtab.h"
+#include "strtab_test.h"
+#include "test.h"
+
+#define MAX_TESTS 13
+
+/** 
+ * @brief Main function for STRTAB unit tests. 
+ * 
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed 
+ *   2.- A number means a particular test (the one identified by that number) 
+ *       is executed
+ *  
+ */
+int main(int argc, char** argv) {
+
+  int test = 0;
+  int all = 1;
+
+  if (argc < 2) {
+    printf("Running all test for module StrTab:\n");
+  } else {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS) {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+
+  if (all || test == 1) test1_strtab_create();
+  if (all || test == 2) test1_strtab_destroy();
+  if (all || test == 3) test2_strtab_destroy();
+  if (all || test == 4) test1_strtab_intern();
+  if (all || test == 5) test2_strtab_intern();
+  if (all || test == 6) test3_strtab_intern();
+  if (all || test == 7) test4_strtab_intern();
+  if (all || test == 8) test5_strtab_intern();
+  if (all || test == 9) test1_strtab_get_number();
+  if (all || test == 10) test2_strtab_get_number();
+  if (all || test == 11) test1_strtab_id();
+  if (all || test == 12) test2_strtab_id();
+  if (all || test == 13) test1_strtab_str();
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+void test1_strtab_create() {
+  StrTab *t;
+  t = strtab_create();
+  PRINT_TEST_RESULT(t != NULL);
+  strtab_destroy(t);
+}
+
+void test1_strtab_destroy() {
+  StrTab *t;
+  t = strtab_create();
+  PRINT_TEST_RESULT(strtab_destroy(t) == OK);
+}
+
+void test2_strtab_destroy() {
+  StrTab *t = NULL;
+  PRINT_TEST_RESULT(strtab_destroy(t) == ERROR);
+}
+
+void test1_strtab_intern() {
+  StrTab *t;
+  t = strtab_create();
+  PRINT_TEST_RESULT(strcmp(strtab_intern(t, "Grano|1101", 5), "Grano") == 0);
+  strtab_destroy(t);
+}
+
+void test2_strtab_intern() {
+  StrTab *t;
+  const char *a, *b;
+  t = strtab_create();
+  a = strtab_intern(t, "Grano", 5);
+  b = strtab_intern(t, "#o:Grano|" + 3, 5);
+  PRINT_TEST_RESULT(a == b);
+  strtab_destroy(t);
+}
+
+void test3_strtab_intern() {
+  StrTab *t;
+  t = strtab_create();
+  PRINT_TEST_RESULT(strtab_intern(t, "Grano", 5) != strtab_intern(t, "Gran", 4));
+  strtab_destroy(t);
+}
+
+void test4_strtab_intern() {
+  StrTab *t = NULL;
+  PRINT_TEST_RESULT(strtab_intern(t, "Grano", 5) == NULL);
+}
+
+void test5_strtab_intern() {
+  StrTab *t;
+  const char *first;
+  char name[16];
+  int i;
+  t = strtab_create();
+  first = strtab_intern(t, "room0", 5);
+  for (i = 1; i < 5000; i++) {
+    sprintf(name, "room%d", i);
+    strtab_intern(t, name, strlen(name));
+  }
+  PRINT_TEST_RESULT(first == strtab_intern(t, "room0", 5) && strcmp(first, "room0") == 0);
+  strtab_destroy(t);
+}
+
+void test1_strtab_get_number() {
+  StrTab *t;
+  t = strtab_create();
+  strtab_intern(t, "ant", 3);
+  strtab_intern(t, "ant", 3);
+  strtab_intern(t, "BOSS1", 5);
+  PRINT_TEST_RESULT(strtab_get_number(t) == 2);
+  strtab_destroy(t);
+}
+
+void test2_strtab_get_number() {
+  StrTab *t = NULL;
+  PRINT_TEST_RESULT(strtab_get_number(t) == -1);
+}
+
+void test1_strtab_id() {
+  char name[8] = "Grano";
+  StrId id;
+  id = strtab_id(name);
+  strcpy(name, "BOSS1");
+  PRINT_TEST_RESULT(id != NO_STR && strtab_id("Grano") == id && strtab_id(name) != id);
+}
+
+void test2_strtab_id() {
+  PRINT_TEST_RESULT(strtab_id("") == NO_STR && strtab_id(NULL) == NO_STR);
+}
+
+void test1_strtab_str() {
+  StrId id;
+  id = strtab_id("ant");
+  PRINT_TEST_RESULT(strcmp(strtab_str(id), "ant") == 0 && strcmp(strtab_str(NO_STR), "") == 0);
+}
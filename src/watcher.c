@@ -0,0 +1,383 @@
+/**
+ * @brief It implements the data file watcher
+ *
+ * The directory of the file is watched rather than the file itself, since
+ * most editors save by writing a new file and renaming it over the old one.
+ *
+ * @file watcher.c
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/inotify.h>
+#include "watcher.h"
+#include "levels.h"
+#include "world.h"
+#include "world_bin.h"
+
+#define EVENT_BUF 4096
+
+/**
+ * @brief What is remembered of a record of the data file
+ */
+typedef struct {
+  char tag;      /*!< Kind of record: s, o, p, e or l */
+  Id id;         /*!< Id of the entity */
+  int idx;       /*!< Position in the file, to keep the first of two records with the same id */
+  uint64_t hash; /*!< Hash of its text, graphic lines included */
+  long offset;   /*!< Position of its graphic lines in the file (spaces only) */
+  Id location;   /*!< Space where the record puts the entity (objects and enemies only) */
+  int health;    /*!< Health the record gives the entity (enemies only) */
+  long start;    /*!< Position of the record in the file, only valid while reloading */
+  long size;     /*!< Length of its text, only valid while reloading */
+} R_Record;
+
+struct _Watcher {
+  int fd;             /*!< inotify descriptor, -1 if the file is not watched */
+  char *path;         /*!< Name of the data file */
+  const char *name;   /*!< Name of the data file inside its directory */
+  R_Record *records;  /*!< Records of the last version read, sorted by tag and id */
+  int n_records;      /*!< Number of records */
+  int changes;        /*!< Records patched on the last reload */
+};
+
+/*--------------------------------------------------------------------------------------------------------*/
+static int watcher_cmp(const void *a, const void *b) {
+  const R_Record *x = a, *y = b;
+
+  if (x->tag != y->tag)
+    return x->tag - y->tag;
+  if (x->id != y->id)
+    return (x->id < y->id) ? -1 : 1;
+
+  return x->idx - y->idx;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Finds the first record with the tag and id of key
+ */
+static const R_Record *watcher_find(const R_Record *records, int n, const R_Record *key) {
+  int lo = 0, hi = n, mid;
+
+  while (lo < hi) {
+    mid = (lo + hi) / 2;
+    if (records[mid].tag < key->tag || (records[mid].tag == key->tag && records[mid].id < key->id))
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return (lo < n && records[lo].tag == key->tag && records[lo].id == key->id) ? &records[lo] : NULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Gives the number in a field of a record, from 0 after the id, skipping empty fields like the loaders
+ */
+static long watcher_field(const char *p, const char *eol, int k) {
+  int field = 0;
+
+  while (p < eol) {
+    while (p < eol && *p == '|')
+      p++;
+    if (p == eol)
+      break;
+    if (field++ == k)
+      return atol(p);
+    while (p < eol && *p != '|')
+      p++;
+  }
+
+  return 0;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Splits a data file in records and hashes them. Nothing but the id, the number of graphic lines
+ * and where objects and enemies start is parsed
+ * @return the records sorted by tag and id, or NULL
+ */
+static R_Record *watcher_scan(const char *data, size_t size, int *n) {
+  const char *p = data, *end = data + size, *eol, *start;
+  R_Record *records = NULL, *aux = NULL;
+  int max = 0, i, nlines;
+
+  *n = 0;
+  while (p < end) {
+    if (!(eol = memchr(p, '\n', end - p)))
+      eol = end;
+
+    if (eol - p < 3 || p[0] != '#' || p[2] != ':' || !strchr("soepl", p[1])) {
+      p = eol + 1;
+      continue;
+    }
+
+    if (*n == max) {
+      if ((aux = (R_Record *)realloc(records, (max + 256 + max / 2) * sizeof(R_Record))) == NULL) {
+        free(records);
+        return NULL;
+      }
+      records = aux;
+      max += 256 + max / 2;
+    }
+
+    start = p;
+    records[*n].tag = p[1];
+    records[*n].id = atol(p + 3);
+    records[*n].idx = *n;
+    records[*n].offset = (eol < end) ? eol + 1 - data : end - data;
+    records[*n].start = start - data;
+    records[*n].location = NO_ID;
+    records[*n].health = 0;
+    if (p[1] == 'o' || p[1] == 'e')
+      records[*n].location = watcher_field(p + 3, eol, 2);
+    if (p[1] == 'e')
+      records[*n].health = watcher_field(p + 3, eol, 3);
+    if (p[1] == 's') {
+      nlines = watcher_field(p + 3, eol, 2);
+      for (i = 0; i < nlines && eol < end; i++) {
+        p = eol + 1;
+        if (!(eol = memchr(p, '\n', end - p)))
+          eol = end;
+      }
+    }
+    records[*n].size = eol - start;
+    records[*n].hash = world_bin_hash(start, eol - start);
+    (*n)++;
+
+    p = eol + 1;
+  }
+
+  if (!records && (records = (R_Record *)malloc(sizeof(R_Record))) == NULL)
+    return NULL;
+
+  qsort(records, *n, sizeof(R_Record), watcher_cmp);
+
+  return records;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Maps the data file and splits it in records
+ */
+static R_Record *watcher_read(const char *path, int *n, char **data, size_t *size) {
+  struct stat st;
+  R_Record *records = NULL;
+  int fd;
+
+  *data = NULL;
+  *size = 0;
+  if ((fd = open(path, O_RDONLY)) < 0)
+    return NULL;
+
+  if (fstat(fd, &st) < 0) {
+    close(fd);
+    return NULL;
+  }
+
+  if (st.st_size > 0) {
+    *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (*data == MAP_FAILED) {
+      close(fd);
+      *data = NULL;
+      return NULL;
+    }
+    *size = st.st_size;
+  }
+  close(fd);
+
+  if ((records = watcher_scan(*data, *size, n)) == NULL && *data) {
+    munmap(*data, *size);
+    *data = NULL;
+  }
+
+  return records;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+Watcher *watcher_create(const char *filename) {
+  Watcher *watcher = NULL;
+  char *data = NULL, *dir = NULL, *slash = NULL;
+  size_t size;
+
+  if (!filename)
+    return NULL;
+
+  if ((watcher = (Watcher *)calloc(1, sizeof(Watcher))) == NULL)
+    return NULL;
+  watcher->fd = -1;
+
+  if ((watcher->path = strdup(filename)) == NULL ||
+      (watcher->records = watcher_read(filename, &watcher->n_records, &data, &size)) == NULL) {
+    watcher_destroy(watcher);
+    return NULL;
+  }
+  if (data)
+    munmap(data, size);
+
+  slash = strrchr(watcher->path, '/');
+  watcher->name = slash ? slash + 1 : watcher->path;
+
+  if ((dir = strdup(filename)) == NULL) {
+    watcher_destroy(watcher);
+    return NULL;
+  }
+  if ((slash = strrchr(dir, '/')) != NULL)
+    slash[slash == dir ? 1 : 0] = '\0';
+
+  if ((watcher->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) < 0 ||
+      inotify_add_watch(watcher->fd, slash ? dir : ".", IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+    free(dir);
+    watcher_destroy(watcher);
+    return NULL;
+  }
+  free(dir);
+
+  return watcher;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS watcher_destroy(Watcher *watcher) {
+  if (!watcher)
+    return ERROR;
+
+  if (watcher->fd >= 0)
+    close(watcher->fd);
+  free(watcher->path);
+  free(watcher->records);
+  free(watcher);
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS watcher_poll(Watcher *watcher, Game *game) {
+  char buf[EVENT_BUF] __attribute__((aligned(__alignof__(struct inotify_event))));
+  const struct inotify_event *ev;
+  BOOL changed = FALSE;
+  ssize_t len;
+  char *p;
+
+  if (!watcher || !game)
+    return ERROR;
+
+  while ((len = read(watcher->fd, buf, EVENT_BUF)) > 0) {
+    for (p = buf; p < buf + len; p += sizeof(struct inotify_event) + ev->len) {
+      ev = (const struct inotify_event *)p;
+      if (ev->len && strcmp(ev->name, watcher->name) == 0)
+        changed = TRUE;
+    }
+  }
+
+  return changed ? watcher_reload(watcher, game) : OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS watcher_reload(Watcher *watcher, Game *game) {
+  R_Record *records = NULL;
+  const R_Record *old = NULL;
+  W_World *w = NULL;
+  Space *space = NULL;
+  STATUS status, reloaded = OK;
+  char *data = NULL;
+  size_t size;
+  int n, i, before;
+
+  if (!watcher || !game)
+    return ERROR;
+
+  if ((records = watcher_read(watcher->path, &n, &data, &size)) == NULL)
+    return ERROR;
+
+  if ((w = world_create()) == NULL) {
+    free(records);
+    if (data)
+      munmap(data, size);
+    return ERROR;
+  }
+
+  /* The levels that are not loaded keep records of the old file, they are read again from the new one */
+  if (game->levels)
+    reloaded = levels_reload(game->levels, game);
+
+  watcher->changes = 0;
+  for (i = 0; i < n; i++) {
+    /* Only the first record with an id counts, like in the loaders */
+    if (i > 0 && records[i].tag == records[i - 1].tag && records[i].id == records[i - 1].id)
+      continue;
+
+    old = watcher_find(watcher->records, watcher->n_records, &records[i]);
+    if (!old)
+      continue;
+
+    if (old->hash == records[i].hash) {
+      /* Unchanged, but the lines before it may have moved its graphic description */
+      if (records[i].tag == 's' && old->offset != records[i].offset && game->art &&
+          (space = game_get_space(game, records[i].id)) != NULL && space_get_art(space) >= 0)
+        art_set(game->art, space_get_art(space), records[i].offset, space_get_nlines(space));
+      continue;
+    }
+
+    before = w->n_spaces + w->n_objects + w->n_players + w->n_enemies + w->n_links;
+    if (world_parse(w, data + records[i].start, records[i].size) == ERROR ||
+        w->n_spaces + w->n_objects + w->n_players + w->n_enemies + w->n_links == before)
+      continue;
+
+    switch (records[i].tag) {
+      case 's':
+        w->spaces[w->n_spaces - 1].offset = records[i].offset;
+        status = world_patch_space(game, &w->spaces[w->n_spaces - 1]);
+        break;
+      case 'o':
+        status = world_patch_object(game, &w->objects[w->n_objects - 1], old->location);
+        break;
+      case 'p':
+        status = world_patch_player(game, &w->players[w->n_players - 1]);
+        break;
+      case 'e':
+        status = world_patch_enemy(game, &w->enemies[w->n_enemies - 1], old->location, old->health);
+        break;
+      case 'l':
+        status = world_patch_link(game, &w->links[w->n_links - 1]);
+        break;
+      default:
+        status = ERROR;
+        break;
+    }
+
+    /* A record of an entity that is not in the game was not applied */
+    if (status == OK)
+      watcher->changes++;
+  }
+
+  /* A patched link may have changed the exits of its spaces */
+  if (watcher->changes > 0)
+    game_resolve_links(game);
+
+  world_destroy(w);
+  if (data)
+    munmap(data, size);
+
+  free(watcher->records);
+  watcher->records = records;
+  watcher->n_records = n;
+
+  return reloaded;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+int watcher_get_changes(Watcher *watcher) {
+  if (!watcher)
+    return -1;
+
+  return watcher->changes;
+}
@@ -0,0 +1,854 @@
+/**
+ * @brief It implements the creation of the game entities from world records
+ *
+ * @file world.c
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "world.h"
+#include "scan.h"
+
+#define FIXUP_CHUNK 64
+#define WORLD_CHUNK 64
+#define MAX_FIELDS 16
+#define CHUNKS_PER_THREAD 4 /* more chunks than threads so a slow chunk does not hold the rest */
+#define MIN_CHUNK 65536
+
+/**
+ * @brief Part of a data file parsed by one thread
+ */
+typedef struct {
+  const char *start; /*!< First record */
+  const char *limit; /*!< Records starting here or later belong to the next chunk */
+  const char *stop;  /*!< First line that was not read */
+  W_World *w;        /*!< Records read */
+  STATUS status;     /*!< Result of the parse */
+} W_Chunk;
+
+/**
+ * @brief Chunks waiting to be parsed, shared by the threads
+ */
+typedef struct {
+  W_Chunk *chunks;      /*!< Every chunk, in file order */
+  int n;                /*!< Number of chunks */
+  int next;             /*!< Next chunk to be taken */
+  const char *data;     /*!< Start of the data */
+  const char *end;      /*!< End of the data */
+  pthread_mutex_t lock; /*!< Protects next */
+} W_Pool;
+
+/**
+ * @brief Index of every array in W_World.max
+ */
+enum { W_SPACES, W_OBJECTS, W_PLAYERS, W_ENEMIES, W_LINKS };
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_queue(W_Fixups *f, Id id, Id space, DIRECTION dir) {
+  W_Fixup *aux = NULL;
+
+  if (!f)
+    return ERROR;
+
+  if (f->n == f->max) {
+    aux = (W_Fixup *)realloc(f->items, (f->max + FIXUP_CHUNK) * sizeof(W_Fixup));
+    if (!aux)
+      return ERROR;
+    f->items = aux;
+    f->max += FIXUP_CHUNK;
+  }
+
+  f->items[f->n].id = id;
+  f->items[f->n].space = space;
+  f->items[f->n].dir = dir;
+  f->n++;
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Makes room for one more element at the end of an array of the world
+ * @return the array, moved if it had to grow, or NULL
+ */
+static void *world_grow(void *array, int n, int *max, size_t size) {
+  void *aux = NULL;
+
+  if (n < *max)
+    return array;
+
+  aux = realloc(array, (*max + WORLD_CHUNK + *max / 2) * size);
+  if (!aux)
+    return NULL;
+  *max += WORLD_CHUNK + *max / 2;
+
+  return aux;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+static long world_long(const ScanField *f) {
+  return scan_long(f->s, f->len);
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+static float world_float(const ScanField *f) {
+  return scan_float(f->s, f->len);
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+W_World *world_create() {
+  W_World *w = NULL;
+
+  w = (W_World *)calloc(1, sizeof(W_World));
+  if (!w)
+    return NULL;
+
+  if ((w->strings = strtab_create()) == NULL) {
+    free(w);
+    return NULL;
+  }
+
+  return w;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_destroy(W_World *w) {
+  int i;
+
+  if (!w)
+    return ERROR;
+
+  free(w->spaces);
+  free(w->objects);
+  free(w->players);
+  free(w->enemies);
+  free(w->links);
+  strtab_destroy(w->strings);
+  for (i = 0; i < w->n_parts; i++) {
+    world_destroy(w->parts[i]);
+  }
+  free(w->parts);
+  free(w);
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Parses the records that start before limit. The graphic lines of the last space may go on
+ * until end
+ * @param data Start of the data file, the position of the graphic lines is measured from it
+ * @param stop Where the first line that was not read is stored
+ */
+static STATUS world_records(W_World *w, const char *data, const char *p, const char *limit, const char *end, const char **stop) {
+  const char *eol;
+  ScanField f[MAX_FIELDS];
+  W_Space *space;
+  W_Object *object;
+  W_Player *player;
+  W_Enemy *enemy;
+  W_Link *link;
+  void *aux;
+  int i, nlines;
+
+  while (p < limit) {
+    if (!(eol = memchr(p, '\n', end - p)))
+      eol = end;
+
+    if (eol - p < 3 || p[0] != '#' || p[2] != ':' || scan_fields(p + 3, eol, f, MAX_FIELDS) < 2) {
+      p = eol + 1;
+      continue;
+    }
+
+    switch (p[1]) {
+      case 's':
+        if (!(aux = world_grow(w->spaces, w->n_spaces, &w->max[W_SPACES], sizeof(W_Space))))
+          return ERROR;
+        w->spaces = aux;
+        space = &w->spaces[w->n_spaces];
+        space->id = world_long(&f[0]);
+        space->name = strtab_intern(w->strings, f[1].s, f[1].len);
+        space->offset = (eol < end) ? eol + 1 - data : end - data;
+        space->gdesc = NULL;
+        nlines = world_long(&f[2]);
+        for (i = 0; i < nlines && eol < end; i++) {
+          p = eol + 1;
+          if (!(eol = memchr(p, '\n', end - p)))
+            eol = end;
+        }
+        space->nlines = i;
+        w->n_spaces++;
+        break;
+
+      case 'o':
+        if (!(aux = world_grow(w->objects, w->n_objects, &w->max[W_OBJECTS], sizeof(W_Object))))
+          return ERROR;
+        w->objects = aux;
+        object = &w->objects[w->n_objects++];
+        object->id = world_long(&f[0]);
+        object->name = strtab_intern(w->strings, f[1].s, f[1].len);
+        object->location = world_long(&f[2]);
+        object->type = world_long(&f[3]);
+        object->buff_type = world_long(&f[4]);
+        object->buff_value = world_float(&f[5]);
+        object->debuff_type = world_long(&f[6]);
+        object->debuff_value = world_float(&f[7]);
+        object->consumable = world_long(&f[8]);
+        object->i = world_long(&f[9]);
+        object->j = world_long(&f[10]);
+        break;
+
+      case 'p':
+        if (!(aux = world_grow(w->players, w->n_players, &w->max[W_PLAYERS], sizeof(W_Player))))
+          return ERROR;
+        w->players = aux;
+        player = &w->players[w->n_players++];
+        player->id = world_long(&f[0]);
+        player->name = strtab_intern(w->strings, f[1].s, f[1].len);
+        player->location = world_long(&f[2]);
+        player->health = world_long(&f[3]);
+        player->capacity = world_long(&f[4]);
+        player->attack = world_float(&f[5]);
+        player->defense = world_float(&f[6]);
+        player->i = world_long(&f[7]);
+        player->j = world_long(&f[8]);
+        break;
+
+      case 'e':
+        if (!(aux = world_grow(w->enemies, w->n_enemies, &w->max[W_ENEMIES], sizeof(W_Enemy))))
+          return ERROR;
+        w->enemies = aux;
+        enemy = &w->enemies[w->n_enemies++];
+        enemy->id = world_long(&f[0]);
+        enemy->name = strtab_intern(w->strings, f[1].s, f[1].len);
+        enemy->location = world_long(&f[2]);
+        enemy->health = world_long(&f[3]);
+        enemy->attack = world_float(&f[4]);
+        enemy->defense = world_float(&f[5]);
+        enemy->i = world_long(&f[6]);
+        enemy->j = world_long(&f[7]);
+        break;
+
+      case 'l':
+        if (!(aux = world_grow(w->links, w->n_links, &w->max[W_LINKS], sizeof(W_Link))))
+          return ERROR;
+        w->links = aux;
+        link = &w->links[w->n_links++];
+        link->id = world_long(&f[0]);
+        link->name = strtab_intern(w->strings, f[1].s, f[1].len);
+        link->origin = world_long(&f[2]);
+        link->destination = world_long(&f[3]);
+        link->dir = world_long(&f[4]);
+        link->open = world_long(&f[5]);
+        link->requirement = world_long(&f[6]);
+        break;
+
+      default:
+        break;
+    }
+
+    p = eol + 1;
+  }
+
+  *stop = (p < end) ? p : end;
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Appends n elements to an array of the world
+ * @return the array, moved if it had to grow, or NULL
+ */
+static void *world_append(void *array, int *n, int *max, const void *src, int n_src, size_t size) {
+  void *aux = array;
+
+  if (*n + n_src > *max) {
+    aux = realloc(array, (*n + n_src) * size);
+    if (!aux)
+      return NULL;
+    *max = *n + n_src;
+  }
+
+  if (n_src > 0)
+    memcpy((char *)aux + *n * size, src, n_src * size);
+  *n += n_src;
+
+  return aux;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Appends every record of src at the end of dst. The strings stay owned by src
+ */
+static STATUS world_merge(W_World *dst, const W_World *src) {
+  void *aux;
+
+  if (!(aux = world_append(dst->spaces, &dst->n_spaces, &dst->max[W_SPACES], src->spaces, src->n_spaces, sizeof(W_Space))))
+    return ERROR;
+  dst->spaces = aux;
+
+  if (!(aux = world_append(dst->objects, &dst->n_objects, &dst->max[W_OBJECTS], src->objects, src->n_objects, sizeof(W_Object))))
+    return ERROR;
+  dst->objects = aux;
+  if (!(aux = world_append(dst->players, &dst->n_players, &dst->max[W_PLAYERS], src->players, src->n_players, sizeof(W_Player))))
+    return ERROR;
+  dst->players = aux;
+  if (!(aux = world_append(dst->enemies, &dst->n_enemies, &dst->max[W_ENEMIES], src->enemies, src->n_enemies, sizeof(W_Enemy))))
+    return ERROR;
+  dst->enemies = aux;
+  if (!(aux = world_append(dst->links, &dst->n_links, &dst->max[W_LINKS], src->links, src->n_links, sizeof(W_Link))))
+    return ERROR;
+  dst->links = aux;
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_parse(W_World *w, const char *data, size_t size) {
+  const char *stop;
+
+  if (!w || !w->strings || (!data && size))
+    return ERROR;
+
+  return world_records(w, data, data, data + size, data + size, &stop);
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Moves a position forward to the start of the next line that begins a record
+ */
+static const char *world_next_record(const char *p, const char *data, const char *end) {
+  const char *eol;
+
+  if (p <= data)
+    return data;
+
+  /* Start from the beginning of the line after p */
+  if (!(eol = memchr(p - 1, '\n', end - p + 1)))
+    return end;
+  p = eol + 1;
+
+  while (p < end) {
+    if (end - p >= 3 && p[0] == '#' && p[2] == ':' && strchr("soepl", p[1]))
+      return p;
+    if (!(eol = memchr(p, '\n', end - p)))
+      return end;
+    p = eol + 1;
+  }
+
+  return end;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Takes chunks from the pool and parses them until there are no chunks left
+ */
+static void *world_worker(void *arg) {
+  W_Pool *pool = arg;
+  W_Chunk *chunk;
+  int k;
+
+  while (1) {
+    pthread_mutex_lock(&pool->lock);
+    k = pool->next++;
+    pthread_mutex_unlock(&pool->lock);
+    if (k >= pool->n)
+      break;
+
+    chunk = &pool->chunks[k];
+    if ((chunk->w = world_create()) == NULL)
+      chunk->status = ERROR;
+    else
+      chunk->status = world_records(chunk->w, pool->data, chunk->start, chunk->limit, pool->end, &chunk->stop);
+  }
+
+  return NULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_parse_parallel(W_World *w, const char *data, size_t size, int nthreads) {
+  W_Pool pool;
+  pthread_t *threads = NULL;
+  STATUS status = OK;
+  BOOL cut = FALSE;
+  int i, k, started = 0;
+
+  if (!w || !w->strings || (!data && size))
+    return ERROR;
+
+  if (nthreads <= 0)
+    nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+
+  pool.n = nthreads * CHUNKS_PER_THREAD;
+  if ((size_t)pool.n > size / MIN_CHUNK)
+    pool.n = size / MIN_CHUNK;
+  if (nthreads < 2 || pool.n < 2)
+    return world_parse(w, data, size);
+
+  pool.chunks = (W_Chunk *)calloc(pool.n, sizeof(W_Chunk));
+  threads = (pthread_t *)calloc(nthreads, sizeof(pthread_t));
+  if (!pool.chunks || !threads) {
+    free(pool.chunks);
+    free(threads);
+    return ERROR;
+  }
+  pool.next = 0;
+  pool.data = data;
+  pool.end = data + size;
+  pthread_mutex_init(&pool.lock, NULL);
+
+  for (k = 0; k < pool.n; k++) {
+    pool.chunks[k].start = world_next_record(data + size / pool.n * k, data, pool.end);
+    pool.chunks[k].stop = pool.chunks[k].start;
+  }
+  for (k = 0; k < pool.n; k++) {
+    pool.chunks[k].limit = (k + 1 < pool.n) ? pool.chunks[k + 1].start : pool.end;
+  }
+
+  for (i = 0; i < nthreads; i++) {
+    if (pthread_create(&threads[i], NULL, world_worker, &pool) != 0)
+      break;
+    started++;
+  }
+  if (started == 0)
+    world_worker(&pool);
+  for (i = 0; i < started; i++) {
+    pthread_join(threads[i], NULL);
+  }
+
+  /* A chunk only starts where the one before it stopped unless it was cut in the middle of the
+   * graphic lines of a space, which have no tag of their own. Then the file is read again serially */
+  for (k = 0; k < pool.n; k++) {
+    if (pool.chunks[k].status == ERROR)
+      status = ERROR;
+    else if (k + 1 < pool.n && pool.chunks[k].stop != pool.chunks[k + 1].start)
+      cut = TRUE;
+  }
+
+  if (status == OK && cut == FALSE && (w->parts = (W_World **)calloc(pool.n, sizeof(W_World *))) == NULL)
+    status = ERROR;
+
+  /* The chunks are merged in file order, so the records end up in the same order as with world_parse */
+  if (status == OK && cut == FALSE) {
+    for (k = 0; k < pool.n; k++) {
+      w->parts[w->n_parts++] = pool.chunks[k].w;
+      if (status == OK)
+        status = world_merge(w, pool.chunks[k].w);
+    }
+  } else {
+    for (k = 0; k < pool.n; k++) {
+      world_destroy(pool.chunks[k].w);
+    }
+  }
+
+  pthread_mutex_destroy(&pool.lock);
+  free(pool.chunks);
+  free(threads);
+
+  if (status == OK && cut == TRUE)
+    return world_parse(w, data, size);
+
+  return status;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_apply(const W_World *w, Game *game) {
+  W_Fixups placed = {NULL, 0, 0}, attached = {NULL, 0, 0};
+  STATUS status = OK;
+  int i;
+
+  if (!w || !game)
+    return ERROR;
+
+  for (i = 0; status == OK && i < w->n_spaces; i++) {
+    status = world_add_space(game, &w->spaces[i]);
+  }
+  for (i = 0; status == OK && i < w->n_objects; i++) {
+    status = world_add_object(game, &w->objects[i], &placed);
+  }
+  for (i = 0; status == OK && i < w->n_players; i++) {
+    status = world_add_player(game, &w->players[i]);
+  }
+  for (i = 0; status == OK && i < w->n_enemies; i++) {
+    status = world_add_enemy(game, &w->enemies[i]);
+  }
+  for (i = 0; status == OK && i < w->n_links; i++) {
+    status = world_add_link(game, &w->links[i], &attached);
+  }
+
+  if (status == OK) {
+    world_fixup(game, &placed, &attached);
+  }
+
+  free(placed.items);
+  free(attached.items);
+
+  return status;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+Space *world_new_space(Game *game, const W_Space *rec) {
+  Space *space = NULL;
+  int i;
+
+  if (!game || !rec)
+    return NULL;
+
+  space = space_create_in(game->arena, rec->id);
+  if (space == NULL)
+    return NULL;
+
+  space_set_name(space, (char *)rec->name);
+  space_set_desc(space, (char *)rec->name);
+  space_set_nlines(space, rec->nlines);
+  if (rec->gdesc) {
+    for (i = 0; i < rec->nlines; i++) {
+      space_set_gdesc(space, (char *)rec->gdesc[i], i);
+    }
+  }
+
+  return space;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_add_space(Game *game, const W_Space *rec) {
+  W_Space plain;
+  Space *space = NULL;
+
+  if (!game || !rec)
+    return ERROR;
+
+  /* With an art store the lines are not copied into the space */
+  plain = *rec;
+  if (game->art)
+    plain.gdesc = NULL;
+
+  if ((space = world_new_space(game, &plain)) == NULL)
+    return OK;
+
+  if (game->art && rec->gdesc)
+    space_set_art(space, game->art, art_add_fixed(game->art, rec->gdesc, rec->nlines));
+  else if (game->art && rec->offset >= 0)
+    space_set_art(space, game->art, art_add(game->art, rec->offset, rec->nlines));
+
+  if (game_add_space(game, space) == ERROR) {
+    space_destroy(space);
+    return ERROR;
+  }
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_add_object(Game *game, const W_Object *rec, W_Fixups *placed) {
+  Object *object = NULL;
+  BD *buff = NULL;
+  BD *debuff = NULL;
+
+  if (!game || !rec)
+    return ERROR;
+
+  object = object_create_in(game->arena, rec->id);
+  if (object == NULL)
+    return OK;
+
+  if ((buff = bd_create_in(game->arena)) == NULL) {
+    object_destroy(object);
+    return ERROR;
+  }
+  if ((debuff = bd_create_in(game->arena)) == NULL) {
+    bd_destroy(buff);
+    object_destroy(object);
+    return ERROR;
+  }
+
+  object_set_name(object, (char *)rec->name);
+  object_setType(object, rec->type);
+
+  object_setBuff(object, buff);
+  object_setBuffType(object, rec->buff_type);
+  object_setBuffValue(object, rec->buff_value);
+
+  object_setDebuff(object, debuff);
+  object_setDebuffType(object, rec->debuff_type);
+  object_setDebuffValue(object, rec->debuff_value);
+
+  object_setIfConsumable(object, rec->consumable);
+  object_setPosition(object, rec->i, rec->j);
+  if (game_add_object(game, object) == ERROR) {
+    object_destroy(object);
+    return ERROR;
+  }
+
+  return placed ? world_queue(placed, rec->id, rec->location, Unkown) : OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_add_player(Game *game, const W_Player *rec) {
+  Player *player = NULL;
+  Inventory *inventory = NULL;
+
+  if (!game || !rec)
+    return ERROR;
+
+  player = player_create_in(game->arena, rec->id);
+  if (player == NULL)
+    return OK;
+
+  if ((inventory = inventory_create_in(game->arena)) == NULL) {
+    player_destroy(player);
+    return ERROR;
+  }
+  player_setName(player, (char *)rec->name);
+  player_setLocation(player, rec->location);
+  player_setPosition(player, rec->i, rec->j);
+  player_setHealth(player, rec->health);
+  player_setAttack(player, rec->attack);
+  player_setDefense(player, rec->defense);
+  inventory_setCapacity(inventory, rec->capacity);
+  player_setInventory(player, inventory);
+
+  return game_add_player(game, player);
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_add_enemy(Game *game, const W_Enemy *rec) {
+  Enemy *enemy = NULL;
+
+  if (!game || !rec)
+    return ERROR;
+
+  enemy = enemy_create_in(game->enemy_table);
+  if (enemy == NULL)
+    return OK;
+
+  enemy_setId(enemy, rec->id);
+  enemy_setName(enemy, (char *)rec->name);
+  enemy_setLocation(enemy, rec->location);
+  enemy_setHealth(enemy, rec->health);
+  enemy_setAttack(enemy, rec->attack);
+  enemy_setDefense(enemy, rec->defense);
+  enemy_setPosition(enemy, rec->i, rec->j);
+  if (game_add_enemy(game, enemy) == ERROR) {
+    enemy_destroy(enemy);
+    return ERROR;
+  }
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_add_link(Game *game, const W_Link *rec, W_Fixups *attached) {
+  Link *link = NULL;
+
+  if (!game || !rec)
+    return ERROR;
+
+  link = link_create_in(game->arena);
+  if (link == NULL)
+    return OK;
+
+  link_setName(link, (char *)rec->name);
+  link_setId(link, rec->id);
+  link_setOrigin(link, rec->origin);
+  link_setDestination(link, rec->destination);
+  link_setDirection(link, rec->dir);
+  link_setOpen(link, rec->open);
+  link_setRequirement(link, rec->requirement);
+  if (game_add_link(game, link) == ERROR) {
+    link_destroy(link);
+    return ERROR;
+  }
+
+  return attached ? world_queue(attached, rec->id, rec->origin, rec->dir) : OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+void world_fixup(Game *game, W_Fixups *placed, W_Fixups *attached) {
+  Space *space = NULL;
+  int i;
+
+  if (!game)
+    return;
+
+  for (i = 0; placed && i < placed->n; i++) {
+    game_set_object_location(game, placed->items[i].id, placed->items[i].space);
+  }
+
+  /* Enemies added before their space, as when a level is loaded again; the rest are already in it */
+  for (i = 0; i < game->n_enemies; i++) {
+    space_add_enemy(game_get_space(game, enemy_getLocation(game->enemy[i])), game->enemy[i]);
+  }
+
+  for (i = 0; attached && i < attached->n; i++) {
+    space = game_get_space(game, attached->items[i].space);
+    switch (attached->items[i].dir) {
+      case N:
+        space_set_north(space, attached->items[i].id);
+        break;
+      case S:
+        space_set_south(space, attached->items[i].id);
+        break;
+      case E:
+        space_set_east(space, attached->items[i].id);
+        break;
+      case W:
+        space_set_west(space, attached->items[i].id);
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (placed)
+    placed->n = 0;
+  if (attached)
+    attached->n = 0;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Sets the exit of a space in a direction
+ */
+static void world_set_exit(Space *space, DIRECTION dir, Id link) {
+  switch (dir) {
+    case N:
+      space_set_north(space, link);
+      break;
+    case S:
+      space_set_south(space, link);
+      break;
+    case E:
+      space_set_east(space, link);
+      break;
+    case W:
+      space_set_west(space, link);
+      break;
+    default:
+      break;
+  }
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+static Id world_get_exit(Space *space, DIRECTION dir) {
+  switch (dir) {
+    case N:
+      return space_get_north(space);
+    case S:
+      return space_get_south(space);
+    case E:
+      return space_get_east(space);
+    case W:
+      return space_get_west(space);
+    default:
+      return NO_ID;
+  }
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_patch_space(Game *game, const W_Space *rec) {
+  Space *space = NULL;
+
+  if (!game || !rec || (space = game_get_space(game, rec->id)) == NULL)
+    return ERROR;
+
+  space_set_name(space, (char *)rec->name);
+  space_set_desc(space, (char *)rec->name);
+  if (game->art && rec->offset >= 0) {
+    if (space_get_art(space) < 0)
+      return space_set_art(space, game->art, art_add(game->art, rec->offset, rec->nlines));
+    art_set(game->art, space_get_art(space), rec->offset, rec->nlines);
+    space_set_nlines(space, rec->nlines);
+  }
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_patch_object(Game *game, const W_Object *rec, Id was) {
+  Object *object = NULL;
+
+  if (!game || !rec || (object = game_get_object(game, rec->id)) == NULL)
+    return ERROR;
+
+  game_set_object_name(game, object, (char *)rec->name);
+  object_setType(object, rec->type);
+  object_setBuffType(object, rec->buff_type);
+  object_setBuffValue(object, rec->buff_value);
+  object_setDebuffType(object, rec->debuff_type);
+  object_setDebuffValue(object, rec->debuff_value);
+  object_setIfConsumable(object, rec->consumable);
+  object_setPosition(object, rec->i, rec->j);
+
+  /* Objects the session has taken or dropped somewhere else stay where they are */
+  if (rec->location != was && game_get_object_location(game, rec->id) == was)
+    game_set_object_location(game, rec->id, rec->location);
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_patch_player(Game *game, const W_Player *rec) {
+  if (!game || !rec || !game->play || player_getId(game->play) != rec->id)
+    return ERROR;
+
+  /* Location, health and inventory belong to the session */
+  player_setName(game->play, (char *)rec->name);
+  player_setAttack(game->play, rec->attack);
+  player_setDefense(game->play, rec->defense);
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_patch_enemy(Game *game, const W_Enemy *rec, Id was, int had) {
+  Enemy *enemy = NULL;
+
+  if (!game || !rec || (enemy = game_get_enemy(game, rec->id)) == NULL)
+    return ERROR;
+
+  enemy_setName(enemy, (char *)rec->name);
+  enemy_setAttack(enemy, rec->attack);
+  enemy_setDefense(enemy, rec->defense);
+  enemy_setPosition(enemy, rec->i, rec->j);
+
+  /* Only an enemy the session has not fought or killed is set as the file says */
+  if (enemy_getLocation(enemy) == was && enemy_getHealth(enemy) == had) {
+    game_set_enemy_location(game, enemy, rec->location);
+    enemy_setHealth(enemy, rec->health);
+  }
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_patch_link(Game *game, const W_Link *rec) {
+  Link *link = NULL;
+  Space *origin = NULL;
+
+  if (!game || !rec || (link = game_get_link(game, rec->id)) == NULL)
+    return ERROR;
+
+  /* Detach it from where it was if it moved */
+  origin = game_get_space(game, link_getOrigin(link));
+  if ((link_getOrigin(link) != rec->origin || link_getDirection(link) != rec->dir) &&
+      world_get_exit(origin, link_getDirection(link)) == rec->id)
+    world_set_exit(origin, link_getDirection(link), NO_ID);
+
+  link_setName(link, (char *)rec->name);
+  link_setOrigin(link, rec->origin);
+  link_setDestination(link, rec->destination);
+  link_setDirection(link, rec->dir);
+  link_setOpen(link, rec->open);
+  link_setRequirement(link, rec->requirement);
+  world_set_exit(game_get_space(game, rec->origin), rec->dir, rec->id);
+
+  return OK;
+}
@@ -0,0 +1,504 @@
+/**
+ * @brief It implements the compiled world format
+ *
+ * @file world_bin.c
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "world_bin.h"
+
+#define WB_ALIGN(n) (((n) + 7) & ~(size_t)7)
+
+/**
+ * @brief Id of a space and its position in the file, to resolve references while compiling
+ */
+typedef struct {
+  Id id;   /*!< Id of the space */
+  int idx; /*!< Index of its record */
+} WB_Key;
+
+/**
+ * @brief Offsets already given to the strings of a world, keyed by pointer since they are interned
+ */
+typedef struct {
+  const char **keys; /*!< Strings, NULL if the slot is free */
+  uint32_t *offs;    /*!< Offset of each string */
+  size_t n_slots;    /*!< Size of the table, power of two */
+  char *blob;        /*!< Strings written so far */
+  size_t used;       /*!< Bytes used in blob */
+  size_t max;        /*!< Bytes allocated in blob */
+  BOOL failed;       /*!< TRUE if some string could not be stored */
+} WB_Strings;
+
+/*--------------------------------------------------------------------------------------------------------*/
+static int world_bin_cmp(const void *a, const void *b) {
+  const WB_Key *x = a, *y = b;
+
+  if (x->id != y->id)
+    return (x->id < y->id) ? -1 : 1;
+
+  return x->idx - y->idx;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Finds the first space with a given id, like game_get_space does
+ * @return its index or WB_NONE
+ */
+static int32_t world_bin_find(const WB_Key *keys, int n, Id id) {
+  int lo = 0, hi = n, mid;
+
+  while (lo < hi) {
+    mid = (lo + hi) / 2;
+    if (keys[mid].id < id)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return (lo < n && keys[lo].id == id) ? keys[lo].idx : WB_NONE;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+static uint32_t world_bin_string(WB_Strings *t, const char *s) {
+  size_t k, len;
+  char *aux;
+
+  if (!s)
+    s = "";
+
+  k = ((uintptr_t)s >> 3) & (t->n_slots - 1);
+  while (t->keys[k]) {
+    if (t->keys[k] == s)
+      return t->offs[k];
+    k = (k + 1) & (t->n_slots - 1);
+  }
+
+  len = strlen(s) + 1;
+  if (t->used + len > t->max) {
+    aux = realloc(t->blob, 2 * (t->used + len));
+    if (!aux) {
+      t->failed = TRUE;
+      return 0;
+    }
+    t->blob = aux;
+    t->max = 2 * (t->used + len);
+  }
+
+  memcpy(t->blob + t->used, s, len);
+  t->keys[k] = s;
+  t->offs[k] = t->used;
+  t->used += len;
+
+  return t->offs[k];
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+uint64_t world_bin_hash(const char *data, size_t size) {
+  uint64_t h = 14695981039346656037ULL;
+  size_t i;
+
+  for (i = 0; i < size; i++) {
+    h ^= (unsigned char)data[i];
+    h *= 1099511628211ULL;
+  }
+
+  return h;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_bin_write(const W_World *w, const char *path, const struct stat *src, uint64_t hash) {
+  WB_Header h;
+  WB_Strings str = {NULL, NULL, 1, NULL, 0, 0, FALSE};
+  WB_Key *keys = NULL;
+  WB_Space *spaces = NULL;
+  WB_Object *objects = NULL;
+  WB_Player *players = NULL;
+  WB_Enemy *enemies = NULL;
+  WB_Link *links = NULL;
+  char tmp[WORD_SIZE];
+  FILE *f = NULL;
+  size_t n_str;
+  int i, o, d;
+  STATUS status = ERROR;
+
+  if (!w || !path || !src)
+    return ERROR;
+
+  n_str = w->n_spaces + w->n_objects + w->n_players + w->n_enemies + w->n_links + 1;
+  while (str.n_slots < 2 * n_str)
+    str.n_slots *= 2;
+  str.keys = calloc(str.n_slots, sizeof(char *));
+  str.offs = calloc(str.n_slots, sizeof(uint32_t));
+  keys = malloc((w->n_spaces + 1) * sizeof(WB_Key));
+  spaces = calloc(w->n_spaces + 1, sizeof(WB_Space));
+  objects = calloc(w->n_objects + 1, sizeof(WB_Object));
+  players = calloc(w->n_players + 1, sizeof(WB_Player));
+  enemies = calloc(w->n_enemies + 1, sizeof(WB_Enemy));
+  links = calloc(w->n_links + 1, sizeof(WB_Link));
+  if (!str.keys || !str.offs || !keys || !spaces || !objects || !players || !enemies || !links)
+    goto end;
+
+  for (i = 0; i < w->n_spaces; i++) {
+    keys[i].id = w->spaces[i].id;
+    keys[i].idx = i;
+    spaces[i].id = w->spaces[i].id;
+    spaces[i].name = world_bin_string(&str, w->spaces[i].name);
+    spaces[i].art = w->spaces[i].offset;
+    spaces[i].nlines = w->spaces[i].nlines;
+    for (d = 0; d < 4; d++) {
+      spaces[i].link[d] = WB_NONE;
+    }
+  }
+  qsort(keys, w->n_spaces, sizeof(WB_Key), world_bin_cmp);
+
+  for (i = 0; i < w->n_objects; i++) {
+    const W_Object *rec = &w->objects[i];
+    objects[i].id = rec->id;
+    objects[i].location = rec->location;
+    objects[i].space = world_bin_find(keys, w->n_spaces, rec->location);
+    objects[i].name = world_bin_string(&str, rec->name);
+    objects[i].type = rec->type;
+    objects[i].buff_type = rec->buff_type;
+    objects[i].buff_value = rec->buff_value;
+    objects[i].debuff_type = rec->debuff_type;
+    objects[i].debuff_value = rec->debuff_value;
+    objects[i].consumable = rec->consumable;
+    objects[i].i = rec->i;
+    objects[i].j = rec->j;
+  }
+
+  for (i = 0; i < w->n_players; i++) {
+    const W_Player *rec = &w->players[i];
+    players[i].id = rec->id;
+    players[i].location = rec->location;
+    players[i].name = world_bin_string(&str, rec->name);
+    players[i].health = rec->health;
+    players[i].capacity = rec->capacity;
+    players[i].attack = rec->attack;
+    players[i].defense = rec->defense;
+    players[i].i = rec->i;
+    players[i].j = rec->j;
+  }
+
+  for (i = 0; i < w->n_enemies; i++) {
+    const W_Enemy *rec = &w->enemies[i];
+    enemies[i].id = rec->id;
+    enemies[i].location = rec->location;
+    enemies[i].name = world_bin_string(&str, rec->name);
+    enemies[i].health = rec->health;
+    enemies[i].attack = rec->attack;
+    enemies[i].defense = rec->defense;
+    enemies[i].i = rec->i;
+    enemies[i].j = rec->j;
+  }
+
+  /* Later links in the same direction replace the earlier ones, as they do when loading the text */
+  for (i = 0; i < w->n_links; i++) {
+    const W_Link *rec = &w->links[i];
+    links[i].id = rec->id;
+    links[i].origin = rec->origin;
+    links[i].destination = rec->destination;
+    links[i].requirement = rec->requirement;
+    links[i].name = world_bin_string(&str, rec->name);
+    links[i].dir = rec->dir;
+    links[i].open = rec->open;
+    o = world_bin_find(keys, w->n_spaces, rec->origin);
+    if (o != WB_NONE && rec->dir >= N && rec->dir <= W)
+      spaces[o].link[rec->dir - N] = i;
+  }
+
+  /* The strings are never empty, so the image always has a valid offset to point to */
+  if (str.used == 0)
+    world_bin_string(&str, "");
+  if (str.failed)
+    goto end;
+
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, WB_MAGIC, 4);
+  h.version = WB_VERSION;
+  h.src_mtime = src->st_mtim.tv_sec;
+  h.src_mtime_ns = src->st_mtim.tv_nsec;
+  h.src_size = src->st_size;
+  h.src_hash = hash;
+  h.n_spaces = w->n_spaces;
+  h.n_objects = w->n_objects;
+  h.n_players = w->n_players;
+  h.n_enemies = w->n_enemies;
+  h.n_links = w->n_links;
+  h.off_spaces = WB_ALIGN(sizeof(WB_Header));
+  h.off_objects = h.off_spaces + WB_ALIGN(h.n_spaces * sizeof(WB_Space));
+  h.off_players = h.off_objects + WB_ALIGN(h.n_objects * sizeof(WB_Object));
+  h.off_enemies = h.off_players + WB_ALIGN(h.n_players * sizeof(WB_Player));
+  h.off_links = h.off_enemies + WB_ALIGN(h.n_enemies * sizeof(WB_Enemy));
+  h.off_strings = h.off_links + WB_ALIGN(h.n_links * sizeof(WB_Link));
+  h.size_strings = str.used;
+
+  snprintf(tmp, WORD_SIZE, "%s.%ld.tmp", path, (long)getpid());
+  if ((f = fopen(tmp, "wb")) == NULL)
+    goto end;
+
+  fwrite(&h, sizeof(h), 1, f);
+  fseek(f, h.off_spaces, SEEK_SET);
+  fwrite(spaces, sizeof(WB_Space), h.n_spaces, f);
+  fseek(f, h.off_objects, SEEK_SET);
+  fwrite(objects, sizeof(WB_Object), h.n_objects, f);
+  fseek(f, h.off_players, SEEK_SET);
+  fwrite(players, sizeof(WB_Player), h.n_players, f);
+  fseek(f, h.off_enemies, SEEK_SET);
+  fwrite(enemies, sizeof(WB_Enemy), h.n_enemies, f);
+  fseek(f, h.off_links, SEEK_SET);
+  fwrite(links, sizeof(WB_Link), h.n_links, f);
+  fseek(f, h.off_strings, SEEK_SET);
+  fwrite(str.blob, 1, str.used, f);
+
+  if (ferror(f) | fclose(f) || rename(tmp, path) < 0)
+    unlink(tmp);
+  else
+    status = OK;
+
+end:
+  free(str.keys);
+  free(str.offs);
+  free(str.blob);
+  free(keys);
+  free(spaces);
+  free(objects);
+  free(players);
+  free(enemies);
+  free(links);
+
+  return status;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Checks that every section, string and index of a mapped image lies inside it
+ */
+static BOOL world_bin_check(const WB_World *wb) {
+  const WB_Header *h = wb->header;
+  uint32_t i;
+  int d;
+
+  if (memcmp(h->magic, WB_MAGIC, 4) != 0 || h->version != WB_VERSION)
+    return FALSE;
+
+  if (h->off_spaces % 8 || h->off_objects % 8 || h->off_players % 8 || h->off_enemies % 8 || h->off_links % 8 ||
+      h->off_spaces + (size_t)h->n_spaces * sizeof(WB_Space) > wb->size ||
+      h->off_objects + (size_t)h->n_objects * sizeof(WB_Object) > wb->size ||
+      h->off_players + (size_t)h->n_players * sizeof(WB_Player) > wb->size ||
+      h->off_enemies + (size_t)h->n_enemies * sizeof(WB_Enemy) > wb->size ||
+      h->off_links + (size_t)h->n_links * sizeof(WB_Link) > wb->size ||
+      h->size_strings == 0 || h->off_strings + (size_t)h->size_strings > wb->size ||
+      wb->strings[h->size_strings - 1] != '\0')
+    return FALSE;
+
+  for (i = 0; i < h->n_spaces; i++) {
+    if (wb->spaces[i].name >= h->size_strings || wb->spaces[i].art < 0 || wb->spaces[i].art > h->src_size)
+      return FALSE;
+    for (d = 0; d < 4; d++) {
+      if (wb->spaces[i].link[d] < WB_NONE || wb->spaces[i].link[d] >= (int32_t)h->n_links)
+        return FALSE;
+    }
+  }
+  for (i = 0; i < h->n_objects; i++) {
+    if (wb->objects[i].name >= h->size_strings || wb->objects[i].space < WB_NONE || wb->objects[i].space >= (int32_t)h->n_spaces)
+      return FALSE;
+  }
+  for (i = 0; i < h->n_players; i++) {
+    if (wb->players[i].name >= h->size_strings)
+      return FALSE;
+  }
+  for (i = 0; i < h->n_enemies; i++) {
+    if (wb->enemies[i].name >= h->size_strings)
+      return FALSE;
+  }
+  for (i = 0; i < h->n_links; i++) {
+    if (wb->links[i].name >= h->size_strings)
+      return FALSE;
+  }
+
+  return TRUE;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+WB_World *world_bin_open(const char *path) {
+  WB_World *wb = NULL;
+  struct stat st;
+  void *data;
+  int fd;
+
+  if (!path)
+    return NULL;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+    return NULL;
+
+  if (fstat(fd, &st) < 0 || st.st_size < (off_t)sizeof(WB_Header)) {
+    close(fd);
+    return NULL;
+  }
+
+  data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+    return NULL;
+
+  if ((wb = (WB_World *)calloc(1, sizeof(WB_World))) == NULL) {
+    munmap(data, st.st_size);
+    return NULL;
+  }
+
+  wb->data = data;
+  wb->size = st.st_size;
+  wb->header = data;
+  wb->spaces = (const WB_Space *)(wb->data + wb->header->off_spaces);
+  wb->objects = (const WB_Object *)(wb->data + wb->header->off_objects);
+  wb->players = (const WB_Player *)(wb->data + wb->header->off_players);
+  wb->enemies = (const WB_Enemy *)(wb->data + wb->header->off_enemies);
+  wb->links = (const WB_Link *)(wb->data + wb->header->off_links);
+  wb->strings = wb->data + wb->header->off_strings;
+
+  if (world_bin_check(wb) == FALSE) {
+    world_bin_close(wb);
+    return NULL;
+  }
+
+  return wb;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_bin_close(WB_World *wb) {
+  if (!wb)
+    return ERROR;
+
+  munmap((void *)wb->data, wb->size);
+  free(wb);
+
+  return OK;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+BOOL world_bin_matches(const WB_World *wb, const struct stat *src, uint64_t hash) {
+  if (!wb || !src)
+    return FALSE;
+
+  return (wb->header->src_mtime == src->st_mtim.tv_sec && wb->header->src_mtime_ns == src->st_mtim.tv_nsec &&
+          wb->header->src_size == src->st_size && wb->header->src_hash == hash) ? TRUE : FALSE;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS world_bin_apply(const WB_World *wb, Game *game) {
+  const WB_Header *h;
+  Space **spaces = NULL;
+  W_Space space;
+  W_Object object;
+  W_Player player;
+  W_Enemy enemy;
+  W_Link link;
+  STATUS status = OK;
+  uint32_t i;
+  int32_t l;
+
+  if (!wb || !game)
+    return ERROR;
+  h = wb->header;
+
+  if ((spaces = calloc(h->n_spaces + 1, sizeof(Space *))) == NULL)
+    return ERROR;
+
+  for (i = 0; status == OK && i < h->n_spaces; i++) {
+    space.id = wb->spaces[i].id;
+    space.name = wb->strings + wb->spaces[i].name;
+    space.nlines = wb->spaces[i].nlines;
+    space.offset = wb->spaces[i].art;
+    space.gdesc = NULL;
+    if ((spaces[i] = world_new_space(game, &space)) == NULL)
+      continue;
+    if (game->art)
+      space_set_art(spaces[i], game->art, art_add(game->art, space.offset, space.nlines));
+    if (game_add_space(game, spaces[i]) == ERROR) {
+      space_destroy(spaces[i]);
+      spaces[i] = NULL;
+      status = ERROR;
+    }
+  }
+
+  for (i = 0; status == OK && i < h->n_objects; i++) {
+    object.id = wb->objects[i].id;
+    object.name = wb->strings + wb->objects[i].name;
+    object.location = wb->objects[i].location;
+    object.type = wb->objects[i].type;
+    object.buff_type = wb->objects[i].buff_type;
+    object.buff_value = wb->objects[i].buff_value;
+    object.debuff_type = wb->objects[i].debuff_type;
+    object.debuff_value = wb->objects[i].debuff_value;
+    object.consumable = wb->objects[i].consumable;
+    object.i = wb->objects[i].i;
+    object.j = wb->objects[i].j;
+    status = world_add_object(game, &object, NULL);
+    if (status == OK && wb->objects[i].space != WB_NONE)
+      game_set_object_location(game, object.id, space_get_id(spaces[wb->objects[i].space]));
+  }
+
+  for (i = 0; status == OK && i < h->n_players; i++) {
+    player.id = wb->players[i].id;
+    player.name = wb->strings + wb->players[i].name;
+    player.location = wb->players[i].location;
+    player.health = wb->players[i].health;
+    player.capacity = wb->players[i].capacity;
+    player.attack = wb->players[i].attack;
+    player.defense = wb->players[i].defense;
+    player.i = wb->players[i].i;
+    player.j = wb->players[i].j;
+    status = world_add_player(game, &player);
+  }
+
+  for (i = 0; status == OK && i < h->n_enemies; i++) {
+    enemy.id = wb->enemies[i].id;
+    enemy.name = wb->strings + wb->enemies[i].name;
+    enemy.location = wb->enemies[i].location;
+    enemy.health = wb->enemies[i].health;
+    enemy.attack = wb->enemies[i].attack;
+    enemy.defense = wb->enemies[i].defense;
+    enemy.i = wb->enemies[i].i;
+    enemy.j = wb->enemies[i].j;
+    status = world_add_enemy(game, &enemy);
+  }
+
+  for (i = 0; status == OK && i < h->n_links; i++) {
+    link.id = wb->links[i].id;
+    link.name = wb->strings + wb->links[i].name;
+    link.origin = wb->links[i].origin;
+    link.destination = wb->links[i].destination;
+    link.dir = wb->links[i].dir;
+    link.open = wb->links[i].open;
+    link.requirement = wb->links[i].requirement;
+    status = world_add_link(game, &link, NULL);
+  }
+
+  for (i = 0; status == OK && i < h->n_spaces; i++) {
+    if (!spaces[i])
+      continue;
+    if ((l = wb->spaces[i].link[0]) != WB_NONE)
+      space_set_north(spaces[i], wb->links[l].id);
+    if ((l = wb->spaces[i].link[1]) != WB_NONE)
+      space_set_south(spaces[i], wb->links[l].id);
+    if ((l = wb->spaces[i].link[2]) != WB_NONE)
+      space_set_east(spaces[i], wb->links[l].id);
+    if ((l = wb->spaces[i].link[3]) != WB_NONE)
+      space_set_west(spaces[i], wb->links[l].id);
+  }
+
+  free(spaces);
+
+  return status;
+}
@@ -0,0 +1,44 @@
+/**
+ * @brief It implements the creation of a game from the world built into the program
+ *
+ * @file world_embed.c
+ * @author Miguel Paterson
+ * @date 17-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <string.h>
+#include "world_embed.h"
+
+/*--------------------------------------------------------------------------------------------------------*/
+STATUS game_create_embedded(Game *game) {
+  W_World w;
+
+  if (!game)
+    return ERROR;
+
+  if (game_create(game) == ERROR)
+    return ERROR;
+
+  /* There is no data file, every art is in the tables */
+  if ((game->art = art_create(NULL, ART_MAX_RESIDENT)) == NULL)
+    return ERROR;
+
+  /* world_apply only reads the records, so the tables can stand for a world */
+  memset(&w, 0, sizeof(W_World));
+  w.spaces = (W_Space *)world_image.spaces;
+  w.n_spaces = world_image.n_spaces;
+  w.objects = (W_Object *)world_image.objects;
+  w.n_objects = world_image.n_objects;
+  w.players = (W_Player *)world_image.players;
+  w.n_players = world_image.n_players;
+  w.enemies = (W_Enemy *)world_image.enemies;
+  w.n_enemies = world_image.n_enemies;
+  w.links = (W_Link *)world_image.links;
+  w.n_links = world_image.n_links;
+
+  if (world_apply(&w, game) == ERROR)
+    return ERROR;
+
+  return game_resolve_links(game);
+}
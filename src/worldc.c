@@ -0,0 +1,301 @@
+/**
+ * @brief It compiles a data file into the binary world format
+ *
+ * The game makes this copy by itself the first time it loads a data file,
+ * this tool lets it be made beforehand.
+ *
+ * With -c it writes instead a C source file with the world as const tables
+ * (see world_embed.h), to build the world into the program. Every different
+ * line of the graphic descriptions is written once, and the art of each
+ * space points to the lines it uses.
+ *
+ * @file worldc.c
+ * @author Miguel Paterson
+ * @date 16-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "worldc.h"
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes a string as a C string literal, NULL if there is none
+ */
+static void worldc_string(FILE *out, const char *s, size_t len) {
+  size_t i;
+
+  if (!s) {
+    fputs("NULL", out);
+    return;
+  }
+
+  fputc('"', out);
+  for (i = 0; i < len; i++) {
+    if (s[i] == '"' || s[i] == '\\' || s[i] == '?') /* '?' so that no trigraph is formed */
+      fprintf(out, "\\%c", s[i]);
+    else if ((unsigned char)s[i] < ' ' || s[i] == 0x7f)
+      fprintf(out, "\\%03o", (unsigned char)s[i]);
+    else
+      fputc(s[i], out);
+  }
+  fputc('"', out);
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes a float so that it is read back exactly
+ */
+static void worldc_float(FILE *out, float f) {
+  if (f == f && f - f == 0)
+    fprintf(out, "%a", f);
+  else
+    fputs("0", out);
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Gives the handle of a line of the data file, writing it as a constant the first time it is seen
+ * @return the handle, or -1 if there is no memory
+ */
+static long worldc_line(FILE *out, const char *p, size_t len, char **emitted, size_t *n_emitted) {
+  static char *buf = NULL;
+  static size_t size = 0;
+  char *aux = NULL;
+  StrId id;
+  size_t n;
+
+  if (len + 1 > size) {
+    if ((aux = (char *)realloc(buf, len + 1)) == NULL)
+      return -1;
+    buf = aux;
+    size = len + 1;
+  }
+  memcpy(buf, p, len);
+  buf[len] = '\0';
+
+  /* A line with a NUL inside is cut there, as the game would print it */
+  if ((id = strtab_id(buf)) == NO_STR && buf[0])
+    return -1;
+
+  if (id >= *n_emitted) {
+    n = 2 * (id + 1);
+    if ((aux = (char *)realloc(*emitted, n)) == NULL)
+      return -1;
+    memset(aux + *n_emitted, 0, n - *n_emitted);
+    *emitted = aux;
+    *n_emitted = n;
+  }
+
+  if (!(*emitted)[id]) {
+    fprintf(out, "static const char line_%u[] = ", id);
+    worldc_string(out, buf, strlen(buf));
+    fputs(";\n", out);
+    (*emitted)[id] = 1;
+  }
+
+  return id;
+}
+
+/*--------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes a world as the C source of world_image. The graphic descriptions are taken from the
+ * data file, where the space records point
+ * @return OK or ERROR
+ */
+static STATUS worldc_write_c(const W_World *w, const char *data, size_t size, const char *source, const char *path) {
+  const char *p, *eol, *end = data + size;
+  FILE *out = NULL;
+  char *emitted = NULL;
+  size_t n_emitted = 0;
+  long *ids = NULL, *aux = NULL, line;
+  int i, k, max_ids = 0;
+
+  if ((out = fopen(path, "w")) == NULL)
+    return ERROR;
+
+  fprintf(out, "/* Made by worldc from %s, do not edit */\n\n#include \"world_embed.h\"\n", source);
+
+  for (i = 0; i < w->n_spaces; i++) {
+    if (w->spaces[i].nlines <= 0 || w->spaces[i].offset < 0)
+      continue;
+    if (w->spaces[i].nlines > max_ids) {
+      if ((aux = (long *)realloc(ids, w->spaces[i].nlines * sizeof(long))) == NULL)
+        break;
+      ids = aux;
+      max_ids = w->spaces[i].nlines;
+    }
+
+    /* The new lines go before the art that uses them first */
+    fputs("\n", out);
+    for (k = 0, p = data + w->spaces[i].offset; k < w->spaces[i].nlines; k++) {
+      eol = (p < end) ? memchr(p, '\n', end - p) : NULL;
+      if (!eol)
+        eol = (p < end) ? end : p;
+      if ((line = worldc_line(out, p, eol - p, &emitted, &n_emitted)) < 0)
+        break;
+      ids[k] = line;
+      p = (eol < end) ? eol + 1 : end;
+    }
+    if (k < w->spaces[i].nlines)
+      break;
+
+    fprintf(out, "static const char *const art_%d[] = {\n", i);
+    for (k = 0; k < w->spaces[i].nlines; k++)
+      fprintf(out, "  line_%ld,\n", ids[k]);
+    fputs("};\n", out);
+  }
+  free(ids);
+  free(emitted);
+
+  if (i < w->n_spaces) {
+    fclose(out);
+    return ERROR;
+  }
+
+  if (w->n_spaces > 0) {
+    fputs("\nstatic const W_Space spaces[] = {\n", out);
+    for (i = 0; i < w->n_spaces; i++) {
+      fprintf(out, "  {%ld, ", w->spaces[i].id);
+      worldc_string(out, w->spaces[i].name, w->spaces[i].name ? strlen(w->spaces[i].name) : 0);
+      if (w->spaces[i].nlines > 0 && w->spaces[i].offset >= 0)
+        fprintf(out, ", %d, -1, art_%d},\n", w->spaces[i].nlines, i);
+      else
+        fputs(", 0, -1, NULL},\n", out);
+    }
+    fputs("};\n", out);
+  }
+
+  if (w->n_objects > 0) {
+    fputs("\nstatic const W_Object objects[] = {\n", out);
+    for (i = 0; i < w->n_objects; i++) {
+      fprintf(out, "  {%ld, ", w->objects[i].id);
+      worldc_string(out, w->objects[i].name, w->objects[i].name ? strlen(w->objects[i].name) : 0);
+      fprintf(out, ", %ld, %d, %d, ", w->objects[i].location, w->objects[i].type, w->objects[i].buff_type);
+      worldc_float(out, w->objects[i].buff_value);
+      fprintf(out, ", %d, ", w->objects[i].debuff_type);
+      worldc_float(out, w->objects[i].debuff_value);
+      fprintf(out, ", %d, %d, %d},\n", (int)w->objects[i].consumable, w->objects[i].i, w->objects[i].j);
+    }
+    fputs("};\n", out);
+  }
+
+  if (w->n_players > 0) {
+    fputs("\nstatic const W_Player players[] = {\n", out);
+    for (i = 0; i < w->n_players; i++) {
+      fprintf(out, "  {%ld, ", w->players[i].id);
+      worldc_string(out, w->players[i].name, w->players[i].name ? strlen(w->players[i].name) : 0);
+      fprintf(out, ", %ld, %d, %d, ", w->players[i].location, w->players[i].health, w->players[i].capacity);
+      worldc_float(out, w->players[i].attack);
+      fputs(", ", out);
+      worldc_float(out, w->players[i].defense);
+      fprintf(out, ", %d, %d},\n", w->players[i].i, w->players[i].j);
+    }
+    fputs("};\n", out);
+  }
+
+  if (w->n_enemies > 0) {
+    fputs("\nstatic const W_Enemy enemies[] = {\n", out);
+    for (i = 0; i < w->n_enemies; i++) {
+      fprintf(out, "  {%ld, ", w->enemies[i].id);
+      worldc_string(out, w->enemies[i].name, w->enemies[i].name ? strlen(w->enemies[i].name) : 0);
+      fprintf(out, ", %ld, %d, ", w->enemies[i].location, w->enemies[i].health);
+      worldc_float(out, w->enemies[i].attack);
+      fputs(", ", out);
+      worldc_float(out, w->enemies[i].defense);
+      fprintf(out, ", %d, %d},\n", w->enemies[i].i, w->enemies[i].j);
+    }
+    fputs("};\n", out);
+  }
+
+  if (w->n_links > 0) {
+    fputs("\nstatic const W_Link links[] = {\n", out);
+    for (i = 0; i < w->n_links; i++) {
+      fprintf(out, "  {%ld, ", w->links[i].id);
+      worldc_string(out, w->links[i].name, w->links[i].name ? strlen(w->links[i].name) : 0);
+      fprintf(out, ", %ld, %ld, %d, %d, %ld},\n", w->links[i].origin, w->links[i].destination, (int)w->links[i].dir,
+              (int)w->links[i].open, w->links[i].requirement);
+    }
+    fputs("};\n", out);
+  }
+
+  fputs("\nconst W_Image world_image = {\n  ", out);
+  worldc_string(out, source, strlen(source));
+  fprintf(out, ",\n  %s, %d,\n  %s, %d,\n  %s, %d,\n  %s, %d,\n  %s, %d\n};\n", w->n_spaces ? "spaces" : "NULL",
+          w->n_spaces, w->n_objects ? "objects" : "NULL", w->n_objects, w->n_players ? "players" : "NULL",
+          w->n_players, w->n_enemies ? "enemies" : "NULL", w->n_enemies, w->n_links ? "links" : "NULL", w->n_links);
+
+  if (ferror(out)) {
+    fclose(out);
+    return ERROR;
+  }
+
+  return fclose(out) == 0 ? OK : ERROR;
+}
+
+/*main program*/
+int main(int argc, char *argv[]) {
+  char out[WORD_SIZE];
+  struct stat st;
+  W_World *world = NULL;
+  FILE *file = NULL;
+  char *data = NULL, *in = NULL;
+  BOOL source = FALSE;
+  STATUS status;
+  int ret = 1, arg = 1;
+
+  if (argc > 1 && strcmp(argv[arg], "-c") == 0) { /*writes the C tables of the world instead*/
+    source = TRUE;
+    arg++;
+  }
+
+  if (argc - arg < 1 || argc - arg > 2) {
+    fprintf(stderr, "Use: %s [-c] <game_data_file> [<output_file>]\n", argv[0]);
+    return 1;
+  }
+  in = argv[arg];
+
+  if (argc - arg == 2)
+    snprintf(out, WORD_SIZE, "%s", argv[arg + 1]);
+  else
+    snprintf(out, WORD_SIZE, "%s%s", in, source ? ".c" : CACHE_EXT);
+
+  if ((file = fopen(in, "r")) == NULL || fstat(fileno(file), &st) < 0) {
+    fprintf(stderr, "Error while opening %s.\n", in);
+    if (file)
+      fclose(file);
+    return 1;
+  }
+
+  if ((data = (char *)malloc(st.st_size + 1)) == NULL || fread(data, 1, st.st_size, file) != (size_t)st.st_size) {
+    fprintf(stderr, "Error while reading %s.\n", in);
+    fclose(file);
+    free(data);
+    return 1;
+  }
+  fclose(file);
+
+  if ((world = world_create()) == NULL || world_parse(world, data, st.st_size) == ERROR) {
+    fprintf(stderr, "Error while parsing %s.\n", in);
+    world_destroy(world);
+    free(data);
+    return 1;
+  }
+
+  if (source)
+    status = worldc_write_c(world, data, st.st_size, in, out);
+  else
+    status = world_bin_write(world, out, &st, world_bin_hash(data, st.st_size));
+
+  if (status == ERROR) {
+    fprintf(stderr, "Error while writing %s.\n", out);
+  } else {
+    printf("%s: %d spaces, %d objects, %d players, %d enemies, %d links\n", out, world->n_spaces, world->n_objects,
+           world->n_players, world->n_enemies, world->n_links);
+    ret = 0;
+  }
+
+  world_destroy(world);
+  free(data);
+
+  return ret;
+}
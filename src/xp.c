@@ -19,13 +19,19 @@ struct _XP
     int maxLevel;
     int max_XP;
     int lvl;
+    Arena *arena;
 };
 
 XP *xp_create()
+{
+    return xp_create_in(NULL);
+}
+
+XP *xp_create_in(Arena *arena)
 {
     XP *newXP = NULL;
 
-    newXP = (XP *)malloc(sizeof(XP));
+    newXP = (XP *)arena_alloc(arena, sizeof(XP));
     if (newXP == NULL)
     {
         return NULL;
@@ -35,10 +41,27 @@ XP *xp_create()
     newXP->level = 1;
     newXP->maxLevel = 7;
     newXP->max_XP = 10;
+    newXP->arena = arena;
 
     return newXP;
 }
 
+XP *xp_copy_in(Arena *arena, XP *xp)
+{
+    XP *copy = NULL;
+
+    if (!xp)
+        return NULL;
+
+    if ((copy = (XP *)arena_alloc(arena, sizeof(XP))) == NULL)
+        return NULL;
+
+    *copy = *xp;
+    copy->arena = arena;
+
+    return copy;
+}
+
 STATUS xp_destroy(XP *xp)
 {
     if (!xp)
@@ -46,7 +69,7 @@ STATUS xp_destroy(XP *xp)
         return ERROR;
     }
 
-    free(xp);
+    arena_free(xp->arena, xp, sizeof(XP));
     return OK;
 }
 